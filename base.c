@@ -26,12 +26,14 @@
 #include "wifi.h"
 #include "rc.h"
 #include "base.h"
+#include "core.h"
 #include "efuse.h"
 #include "cam.h"
 #include "ps.h"
 #include "regd.h"
 #include "pci.h"
 #include <linux/ip.h>
+#include <linux/jhash.h>
 #include <linux/module.h>
 #include <linux/udp.h>
 
@@ -690,7 +692,6 @@ int rtl_init_core(struct ieee80211_hw *hw)
 	spin_lock_init(&rtlpriv->locks.rf_lock);
 	spin_lock_init(&rtlpriv->locks.waitq_lock);
 	spin_lock_init(&rtlpriv->locks.entry_list_lock);
-	spin_lock_init(&rtlpriv->locks.c2hcmd_lock);
 	spin_lock_init(&rtlpriv->locks.scan_list_lock);
 	spin_lock_init(&rtlpriv->locks.cck_and_rw_pagea_lock);
 	spin_lock_init(&rtlpriv->locks.check_sendpkt_lock);
@@ -699,8 +700,21 @@ int rtl_init_core(struct ieee80211_hw *hw)
 	spin_lock_init(&rtlpriv->locks.iqk_lock);
 	/* <5> init list */
 	INIT_LIST_HEAD(&rtlpriv->entry_list);
-	INIT_LIST_HEAD(&rtlpriv->c2hcmd_list);
+	rtlpriv->c2hcmd_ring.head = 0;
+	rtlpriv->c2hcmd_ring.tail = 0;
 	INIT_LIST_HEAD(&rtlpriv->scan_list.list);
+	hash_init(rtlpriv->scan_list.hash);
+	hash_init(rtlpriv->sec.cam_sta_hash);
+	skb_queue_head_init(&rtlpriv->tx_report.queue);
+	init_waitqueue_head(&rtlpriv->tx_report.waitq);
+	rtl_rc_init(hw);
+	rtlpriv->link_info.traffic_time = jiffies;
+
+	rtlpriv->pcpu_stats = netdev_alloc_pcpu_stats(struct rtl_pcpu_stats);
+	if (!rtlpriv->pcpu_stats) {
+		pr_err("Can't allocate the per CPU counters\n");
+		return 1;
+	}
 
 	rtlmac->link_state = MAC80211_NOLINK;
 
@@ -712,11 +726,20 @@ int rtl_init_core(struct ieee80211_hw *hw)
 EXPORT_SYMBOL_GPL(rtl_init_core);
 
 static void rtl_free_entries_from_scan_list(struct ieee80211_hw *hw);
+static void rtl_tx_report_purge(struct ieee80211_hw *hw);
 
 void rtl_deinit_core(struct ieee80211_hw *hw)
 {
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+
 	rtl_c2hcmd_launcher(hw, 0);
 	rtl_free_entries_from_scan_list(hw);
+	rtl_tx_report_purge(hw);
+	free_percpu(rtlpriv->pcpu_stats);
+	rtlpriv->pcpu_stats = NULL;
+	rtl_phy_prog_free(hw);
+	rtl_cal_cache_free(hw);
+	rtl_pwrseq_free(hw);
 }
 EXPORT_SYMBOL_GPL(rtl_deinit_core);
 
@@ -1246,8 +1269,10 @@ void rtl_get_tcb_desc(struct ieee80211_hw *hw,
 	if (txrate)
 		tcb_desc->hw_rate = txrate->hw_value;
 
-	if (rtl_is_tx_report_skb(hw, skb))
+	if (rtl_is_tx_report_skb(hw, skb)) {
 		tcb_desc->use_spe_rpt = 1;
+		tcb_desc->tx_report_eapol = rtl_is_eapol_skb(hw, skb);
+	}
 
 	if (ieee80211_is_data(fc)) {
 		/*
@@ -1298,6 +1323,7 @@ void rtl_get_tcb_desc(struct ieee80211_hw *hw,
 		else if (is_broadcast_ether_addr(ieee80211_get_DA(hdr)))
 			tcb_desc->broadcast = 1;
 
+		rtl_rc_tx_override(hw, sta, tcb_desc);
 		_rtl_txrate_selectmode(hw, sta, tcb_desc);
 		_rtl_query_bandwidth_mode(hw, sta, tcb_desc);
 		_rtl_qurey_shortpreamble_mode(hw, tcb_desc, info);
@@ -1564,22 +1590,63 @@ end:
 }
 EXPORT_SYMBOL_GPL(rtl_is_special_data);
 
-bool rtl_is_tx_report_skb(struct ieee80211_hw *hw, struct sk_buff *skb)
+static bool rtl_is_eapol_skb(struct ieee80211_hw *hw, struct sk_buff *skb)
 {
-	u16 ether_type;
 	const u8 *ether_type_ptr;
 
 	ether_type_ptr = rtl_skb_ether_type_ptr(hw, skb, true);
-	ether_type = be16_to_cpup((__be16 *)ether_type_ptr);
+	return be16_to_cpup((__be16 *)ether_type_ptr) == ETH_P_PAE;
+}
+
+bool rtl_is_tx_report_skb(struct ieee80211_hw *hw, struct sk_buff *skb)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct ieee80211_tx_info *info = IEEE80211_SKB_CB(skb);
+	struct ieee80211_hdr *hdr = rtl_get_hdr(skb);
 
-	/* EAPOL */
-	if (ether_type == ETH_P_PAE)
+	if (rtl_is_eapol_skb(hw, skb))
 		return true;
 
-	return false;
+	if (!rtlpriv->cfg->tx_status_report)
+		return false;
+
+	if (info->flags & IEEE80211_TX_CTL_REQ_TX_STATUS)
+		return true;
+
+	/* the firmware has no per-MPDU report for aggregated frames */
+	if (info->flags & (IEEE80211_TX_CTL_AMPDU | IEEE80211_TX_CTL_NO_ACK))
+		return false;
+
+	return !is_multicast_ether_addr(hdr->addr1);
 }
 
-static u16 rtl_get_tx_report_sn(struct ieee80211_hw *hw)
+/* Kept in the skb between rtl_tx_report_prepare() and the report.
+ * rate_driver_data[0] and [1] are used by rtl_usb.
+ */
+struct rtl_tx_report_info {
+	u16 sn;
+	u8 pending;
+	/* low 32 bits of jiffies, only 8 bytes are left on 64-bit */
+	u32 send_time;
+};
+
+#ifndef time_after32
+#define time_after32(a, b)	((s32)((u32)(b) - (u32)(a)) < 0)
+#define time_before32(b, a)	time_after32(a, b)
+#endif
+
+static struct rtl_tx_report_info *rtl_tx_report_info(struct sk_buff *skb)
+{
+	struct ieee80211_tx_info *info = IEEE80211_SKB_CB(skb);
+
+	BUILD_BUG_ON(sizeof(struct rtl_tx_report_info) >
+		     sizeof(info->rate_driver_data) -
+		     2 * sizeof(info->rate_driver_data[0]));
+
+	return (struct rtl_tx_report_info *)&info->rate_driver_data[2];
+}
+
+static u16 rtl_get_tx_report_sn(struct ieee80211_hw *hw, bool eapol)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_tx_report *tx_report = &rtlpriv->tx_report;
@@ -1588,7 +1655,13 @@ static u16 rtl_get_tx_report_sn(struct ieee80211_hw *hw)
 	sn = atomic_inc_return(&tx_report->sn) & 0x0FFF;
 
 	tx_report->last_sent_sn = sn;
-	tx_report->last_sent_time = jiffies;
+	if (eapol) {
+		WRITE_ONCE(tx_report->eapol_sn, sn);
+		tx_report->eapol_time = jiffies;
+		/* pairs with the barrier of wait_event_timeout() */
+		smp_wmb();
+		WRITE_ONCE(tx_report->eapol_pending, true);
+	}
 
 	RT_TRACE(rtlpriv, COMP_TX_REPORT, DBG_DMESG,
 		 "Send TX-Report sn=0x%X\n", sn);
@@ -1600,39 +1673,214 @@ void rtl_get_tx_report(struct rtl_tcb_desc *ptcb_desc, u8 *pdesc,
 		       struct ieee80211_hw *hw)
 {
 	if (ptcb_desc->use_spe_rpt) {
-		u16 sn = rtl_get_tx_report_sn(hw);
+		u16 sn = rtl_get_tx_report_sn(hw, ptcb_desc->tx_report_eapol);
 
 		SET_TX_DESC_SPE_RPT(pdesc, 1);
 		SET_TX_DESC_SW_DEFINE(pdesc, sn);
+		ptcb_desc->tx_report_sn = sn;
 	}
 }
 EXPORT_SYMBOL_GPL(rtl_get_tx_report);
 
+/* Called by the interface once fill_tx_desc() has run for skb */
+void rtl_tx_report_prepare(struct ieee80211_hw *hw, struct sk_buff *skb,
+			   struct rtl_tcb_desc *ptcb_desc)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_tx_report_info *rpt_info = rtl_tx_report_info(skb);
+
+	rpt_info->pending = rtlpriv->cfg->tx_status_report &&
+			    ptcb_desc->use_spe_rpt;
+	rpt_info->sn = ptcb_desc->tx_report_sn;
+}
+EXPORT_SYMBOL_GPL(rtl_tx_report_prepare);
+
+/* Called by the interface when the hardware is done with skb. Returns
+ * true if the status of skb is reported later by
+ * rtl_tx_report_handler(), the caller must not touch skb then.
+ */
+bool rtl_tx_report_hold(struct ieee80211_hw *hw, struct sk_buff *skb)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_tx_report *tx_report = &rtlpriv->tx_report;
+	struct rtl_tx_report_info *rpt_info;
+	struct sk_buff **slot;
+	unsigned long flags;
+
+	if (!rtlpriv->cfg->tx_status_report)
+		return false;
+
+	rpt_info = rtl_tx_report_info(skb);
+	if (!rpt_info->pending)
+		return false;
+
+	rpt_info->send_time = (u32)jiffies;
+	slot = &tx_report->slot[rpt_info->sn % RTL_TX_REPORT_SLOTS];
+
+	spin_lock_irqsave(&tx_report->queue.lock, flags);
+	__skb_queue_tail(&tx_report->queue, skb);
+	if (!*slot)
+		*slot = skb;
+	else
+		tx_report->unslotted++;
+	spin_unlock_irqrestore(&tx_report->queue.lock, flags);
+	return true;
+}
+
+/* with queue.lock held */
+static void rtl_tx_report_unlink(struct rtl_tx_report *tx_report,
+				 struct sk_buff *skb)
+{
+	struct sk_buff **slot;
+
+	slot = &tx_report->slot[rtl_tx_report_info(skb)->sn %
+				RTL_TX_REPORT_SLOTS];
+	if (*slot == skb)
+		*slot = NULL;
+	else
+		tx_report->unslotted--;
+	__skb_unlink(skb, &tx_report->queue);
+}
+EXPORT_SYMBOL_GPL(rtl_tx_report_hold);
+
+static void rtl_tx_report_status(struct ieee80211_hw *hw, struct sk_buff *skb,
+				 bool acked, u8 retry)
+{
+	struct ieee80211_tx_info *info = IEEE80211_SKB_CB(skb);
+
+	ieee80211_tx_info_clear_status(info);
+	if (acked)
+		info->flags |= IEEE80211_TX_STAT_ACK;
+	info->status.rates[0].count = retry + 1;
+	info->status.rates[1].idx = -1;
+
+	ieee80211_tx_status_irqsafe(hw, skb);
+}
+
 void rtl_tx_report_handler(struct ieee80211_hw *hw, u8 *tmp_buf, u8 c2h_cmd_len)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_tx_report *tx_report = &rtlpriv->tx_report;
+	struct sk_buff_head *queue = &tx_report->queue;
+	struct sk_buff *skb, *tmp, *found = NULL;
+	unsigned long flags;
 	u16 sn;
+	u8 st;
+	u8 retry;
 
-	sn = ((tmp_buf[7] & 0x0F) << 8) | tmp_buf[6];
+	sn = GET_TX_REPORT_SN(tmp_buf);
+	st = GET_TX_REPORT_ST(tmp_buf);
+	retry = GET_TX_REPORT_RETRY(tmp_buf);
 
 	tx_report->last_recv_sn = sn;
+	if (READ_ONCE(tx_report->eapol_pending) &&
+	    sn == READ_ONCE(tx_report->eapol_sn)) {
+		WRITE_ONCE(tx_report->eapol_pending, false);
+		wake_up(&tx_report->waitq);
+	}
 
 	RT_TRACE(rtlpriv, COMP_TX_REPORT, DBG_DMESG,
 		 "Recv TX-Report st=0x%02X sn=0x%X retry=0x%X\n",
 		 tmp_buf[0], sn, tmp_buf[2]);
+
+	spin_lock_irqsave(&queue->lock, flags);
+	skb = tx_report->slot[sn % RTL_TX_REPORT_SLOTS];
+	if (skb && rtl_tx_report_info(skb)->sn == sn) {
+		found = skb;
+	} else if (tx_report->unslotted) {
+		/* the slot may have been taken when the frame was held */
+		skb_queue_walk_safe(queue, skb, tmp) {
+			if (rtl_tx_report_info(skb)->sn == sn) {
+				found = skb;
+				break;
+			}
+		}
+	}
+	if (found)
+		rtl_tx_report_unlink(tx_report, found);
+	spin_unlock_irqrestore(&queue->lock, flags);
+
+	if (!found) {
+		tx_report->unmatched++;
+		return;
+	}
+
+	if (st == 0)
+		tx_report->acked++;
+	else
+		tx_report->failed++;
+	tx_report->retries += retry;
+
+	rtl_tx_report_status(hw, found, st == 0, retry);
 }
 EXPORT_SYMBOL_GPL(rtl_tx_report_handler);
 
+/* Frames still waiting when the core goes away were maybe never sent,
+ * ieee80211_free_txskb() reports them as not acked
+ */
+static void rtl_tx_report_purge(struct ieee80211_hw *hw)
+{
+	struct rtl_tx_report *tx_report = &rtl_priv(hw)->tx_report;
+	struct sk_buff_head purged;
+	unsigned long flags;
+
+	skb_queue_head_init(&purged);
+
+	spin_lock_irqsave(&tx_report->queue.lock, flags);
+	skb_queue_splice_init(&tx_report->queue, &purged);
+	memset(tx_report->slot, 0, sizeof(tx_report->slot));
+	tx_report->unslotted = 0;
+	spin_unlock_irqrestore(&tx_report->queue.lock, flags);
+
+	ieee80211_purge_tx_queue(hw, &purged);
+}
+
+/* Frames whose report got lost are reported as not acked */
+static void rtl_tx_report_expire(struct ieee80211_hw *hw)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_tx_report *tx_report = &rtlpriv->tx_report;
+	struct sk_buff_head *queue = &tx_report->queue;
+	struct sk_buff_head expired;
+	struct sk_buff *skb, *tmp;
+	unsigned long flags;
+
+	__skb_queue_head_init(&expired);
+
+	/* frames are held in send order, stop at the first young one */
+	spin_lock_irqsave(&queue->lock, flags);
+	skb_queue_walk_safe(queue, skb, tmp) {
+		if (time_before32((u32)jiffies,
+				  rtl_tx_report_info(skb)->send_time +
+				  msecs_to_jiffies(RTL_TX_REPORT_TIMEOUT_MS)))
+			break;
+
+		rtl_tx_report_unlink(tx_report, skb);
+		__skb_queue_tail(&expired, skb);
+	}
+	spin_unlock_irqrestore(&queue->lock, flags);
+
+	while ((skb = __skb_dequeue(&expired))) {
+		RT_TRACE(rtlpriv, COMP_TX_REPORT, DBG_LOUD,
+			 "TX-Report sn=0x%X timeout\n",
+			 rtl_tx_report_info(skb)->sn);
+		tx_report->timeout++;
+		rtl_tx_report_status(hw, skb, false, 0);
+	}
+}
+
 bool rtl_check_tx_report_acked(struct ieee80211_hw *hw)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_tx_report *tx_report = &rtlpriv->tx_report;
 
-	if (tx_report->last_sent_sn == tx_report->last_recv_sn)
+	/* only the frames before the key change matter, not the data
+	 * frames that get a report too
+	 */
+	if (!READ_ONCE(tx_report->eapol_pending))
 		return true;
 
-	if (time_before(tx_report->last_sent_time + 3 * HZ, jiffies)) {
+	if (time_before(tx_report->eapol_time + 3 * HZ, jiffies)) {
 		RT_TRACE(rtlpriv, COMP_TX_REPORT, DBG_WARNING,
 			 "Check TX-Report timeout!!\n");
 		return true;	/* 3 sec. (timeout) seen as acked */
@@ -1641,18 +1889,31 @@ bool rtl_check_tx_report_acked(struct ieee80211_hw *hw)
 	return false;
 }
 
+/* Sleeps until the report of the last EAPOL frame arrives, at most
+ * wait_ms. rtl_tx_report_handler() wakes us when it does.
+ */
 void rtl_wait_tx_report_acked(struct ieee80211_hw *hw, u32 wait_ms)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
-	int i;
-
-	for (i = 0; i < wait_ms; i++) {
-		if (rtl_check_tx_report_acked(hw))
-			break;
-		usleep_range(1000, 2000);
+	struct rtl_tx_report *tx_report = &rtlpriv->tx_report;
+	ktime_t start = ktime_get();
+	long left;
+	u32 ms;
+
+	left = wait_event_timeout(tx_report->waitq,
+				  rtl_check_tx_report_acked(hw),
+				  msecs_to_jiffies(wait_ms));
+	ms = div_u64(ktime_us_delta(ktime_get(), start), 1000);
+
+	tx_report->waits++;
+	if (!left) {
+		tx_report->wait_timeouts++;
 		RT_TRACE(rtlpriv, COMP_SEC, DBG_DMESG,
-			 "Wait 1ms (%d/%d) to disable key.\n", i, wait_ms);
+			 "No TX-Report after %d ms, disable key anyway.\n",
+			 wait_ms);
 	}
+	tx_report->wait_hist[min_t(u32, fls(ms),
+				   RTL_TX_REPORT_WAIT_HIST - 1)]++;
 }
 /*********************************************************
  *
@@ -1810,45 +2071,292 @@ EXPORT_SYMBOL(rtl_rx_ampdu_apply);
  * wq & timer callback functions
  *
  *********************************************************/
-/* this function is used for roaming */
-void rtl_beacon_statistic(struct ieee80211_hw *hw, struct sk_buff *skb)
+/* Indexes the elements of a beacon or probe response once, for all the
+ * consumers in the RX path. Other frames only get the header fields, and
+ * so do all frames when @ies is false.
+ */
+void rtl_parse_rx_mgmt(struct ieee80211_hw *hw, struct sk_buff *skb,
+		       struct rtl_rx_mgmt *rx_mgmt, bool ies)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
-	struct ieee80211_hdr *hdr = (struct ieee80211_hdr *)skb->data;
+	struct ieee80211_mgmt *mgmt = (void *)skb->data;
+	static const u8 p2p_oui_ie_type[4] = {0x50, 0x6f, 0x9a, 0x09};
+	u8 *pos, *end;
 
-	if (rtlpriv->mac80211.opmode != NL80211_IFTYPE_STATION)
+	rx_mgmt->hdr = (struct ieee80211_hdr *)skb->data;
+	rx_mgmt->bcn = false;
+	rx_mgmt->from_bssid = false;
+	rx_mgmt->has_ies = false;
+	rx_mgmt->tim = NULL;
+	rx_mgmt->p2p = NULL;
+	rx_mgmt->num_vendor = 0;
+	rx_mgmt->vendor_overflow = false;
+
+	/* too short for a management header, nobody looks at it */
+	if (skb->len < 24 + FCS_LEN) {
+		rx_mgmt->len = 0;
 		return;
+	}
 
-	if (rtlpriv->mac80211.link_state < MAC80211_LINKED)
+	rx_mgmt->len = skb->len - FCS_LEN;
+	rx_mgmt->bcn = ieee80211_is_beacon(mgmt->frame_control) ||
+		       ieee80211_is_probe_resp(mgmt->frame_control);
+	rx_mgmt->from_bssid = ieee80211_is_mgmt(mgmt->frame_control) &&
+			      ether_addr_equal_64bits(mgmt->bssid,
+						      rtlpriv->mac80211.bssid);
+	/* min. beacon length + FCS_LEN */
+	rx_mgmt->has_ies = skb->len > 40 + FCS_LEN;
+
+	if (!rx_mgmt->bcn)
 		return;
 
-	/* check if this really is a beacon */
-	if (!ieee80211_is_beacon(hdr->frame_control) &&
-	    !ieee80211_is_probe_resp(hdr->frame_control))
+	rx_mgmt->start = ktime_get_ns();
+	if (!rx_mgmt->has_ies || !ies)
 		return;
 
-	/* min. beacon length + FCS_LEN */
-	if (skb->len <= 40 + FCS_LEN)
+	pos = (u8 *)mgmt->u.beacon.variable;
+	end = skb->data + rx_mgmt->len;
+	while (pos + 2 <= end && pos + 2 + pos[1] <= end) {
+		switch (pos[0]) {
+		case WLAN_EID_TIM:
+			if (!rx_mgmt->tim)
+				rx_mgmt->tim = pos;
+			break;
+		case WLAN_EID_VENDOR_SPECIFIC:
+			if (rx_mgmt->num_vendor < RTL_RX_MGMT_MAX_VENDOR_IES)
+				rx_mgmt->vendor[rx_mgmt->num_vendor++] = pos;
+			else
+				rx_mgmt->vendor_overflow = true;
+			if (!rx_mgmt->p2p && pos[1] > 4 &&
+			    !memcmp(&pos[2], p2p_oui_ie_type, 4))
+				rx_mgmt->p2p = pos;
+			break;
+		default:
+			break;
+		}
+		pos += 2 + pos[1];
+	}
+}
+EXPORT_SYMBOL_GPL(rtl_parse_rx_mgmt);
+
+void rtl_rx_mgmt_done(struct ieee80211_hw *hw, struct rtl_rx_mgmt *rx_mgmt)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+
+	if (!rx_mgmt->bcn)
+		return;
+
+	rtlpriv->stats.rx_bcn_parsed++;
+	rtlpriv->stats.rx_bcn_ns += ktime_get_ns() - rx_mgmt->start;
+}
+EXPORT_SYMBOL_GPL(rtl_rx_mgmt_done);
+
+/*********************************************************
+ *
+ * traffic estimate
+ *
+ *********************************************************/
+const char rtl_data_stats_strings[][ETH_GSTRING_LEN] = {
+	"tx_bytes_unicast", "tx_bytes_multicast", "tx_bytes_broadcast",
+	"rx_bytes_unicast", "tx_data", "rx_data",
+	"tidtx_0", "tidtx_1", "tidtx_2", "tidtx_3",
+	"tidtx_4", "tidtx_5", "tidtx_6", "tidtx_7",
+	"tx_pkts_vo", "tx_pkts_vi", "tx_pkts_be", "tx_pkts_bk",
+	"tx_bytes_vo", "tx_bytes_vi", "tx_bytes_be", "tx_bytes_bk",
+	"rx_pkts_vo", "rx_pkts_vi", "rx_pkts_be", "rx_pkts_bk",
+	"rx_bytes_vo", "rx_bytes_vi", "rx_bytes_be", "rx_bytes_bk",
+};
+EXPORT_SYMBOL_GPL(rtl_data_stats_strings);
+
+void rtl_data_stats_read(struct rtl_priv *rtlpriv, struct rtl_data_stats *sum)
+{
+	u64 *dst = (u64 *)sum;
+	int cpu, i;
+
+	BUILD_BUG_ON(sizeof(rtl_data_stats_strings) / ETH_GSTRING_LEN !=
+		     RTL_DATA_STATS_LEN);
+
+	memset(sum, 0, sizeof(*sum));
+	for_each_possible_cpu(cpu) {
+		struct rtl_pcpu_stats *pcpu =
+			per_cpu_ptr(rtlpriv->pcpu_stats, cpu);
+		struct rtl_data_stats tmp;
+		const u64 *src = (const u64 *)&tmp;
+		unsigned int start;
+
+		do {
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(3, 15, 0)) && \
+    (LINUX_VERSION_CODE < KERNEL_VERSION(6, 2, 0))
+			start = u64_stats_fetch_begin_irq(&pcpu->syncp);
+			tmp = pcpu->s;
+		} while (u64_stats_fetch_retry_irq(&pcpu->syncp, start));
+#else
+			start = u64_stats_fetch_begin(&pcpu->syncp);
+			tmp = pcpu->s;
+		} while (u64_stats_fetch_retry(&pcpu->syncp, start));
+#endif
+
+		for (i = 0; i < RTL_DATA_STATS_LEN; i++)
+			dst[i] += src[i];
+	}
+}
+EXPORT_SYMBOL_GPL(rtl_data_stats_read);
+
+void rtl_traffic_tx(struct ieee80211_hw *hw, struct sk_buff *skb)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct ieee80211_hdr *hdr = rtl_get_hdr(skb);
+	u16 queue = skb_get_queue_mapping(skb);
+	struct rtl_pcpu_stats *pcpu;
+	unsigned long flags;
+
+	if (!ieee80211_is_data(hdr->frame_control) ||
+	    queue >= IEEE80211_NUM_ACS)
+		return;
+
+	pcpu = rtl_data_stats_begin(rtlpriv, &flags);
+	pcpu->s.tx_pkts[queue]++;
+	pcpu->s.tx_bytes[queue] += skb->len;
+	rtl_data_stats_end(rtlpriv, pcpu, flags);
+}
+EXPORT_SYMBOL_GPL(rtl_traffic_tx);
+
+/* a unicast data frame was received */
+void rtl_traffic_rx(struct ieee80211_hw *hw, struct sk_buff *skb)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct ieee80211_hdr *hdr = rtl_get_hdr(skb);
+	struct rtl_pcpu_stats *pcpu;
+	unsigned long flags;
+	u8 queue = IEEE80211_AC_BE;
+
+	if (ieee80211_is_data_qos(hdr->frame_control))
+		queue = ieee802_1d_to_ac[rtl_get_tid(skb) & 7];
+
+	pcpu = rtl_data_stats_begin(rtlpriv, &flags);
+	pcpu->s.rx_data++;
+	pcpu->s.rx_pkts[queue]++;
+	pcpu->s.rx_bytes[queue] += skb->len;
+	rtl_data_stats_end(rtlpriv, pcpu, flags);
+}
+EXPORT_SYMBOL_GPL(rtl_traffic_rx);
+
+static u32 _rtl_traffic_rate(u64 count, unsigned long elapsed)
+{
+	return div_u64(count * HZ, elapsed);
+}
+
+/* avg is kept scaled, so small rates don't round down to zero */
+static u32 _rtl_traffic_ewma(u32 avg, u32 sample)
+{
+	return avg - (avg >> RTL_TRAFFIC_EWMA_SHIFT) + sample;
+}
+
+/* turn on above thresh, off only below 3/4 of it */
+static bool _rtl_traffic_busy(u32 pps, u32 thresh, bool busy)
+{
+	if (busy)
+		return pps >= thresh - (thresh >> 2);
+	return pps > thresh;
+}
+
+/* called from the watchdog, sums up the data path counters and folds
+ * what came in since the last call into the per period counts and the
+ * per AC averages
+ */
+void rtl_traffic_update(struct ieee80211_hw *hw)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rt_link_detect *link = &rtlpriv->link_info;
+	struct rtl_data_stats *last = &rtlpriv->data_last;
+	struct rtl_data_stats now_stats;
+	unsigned long now = jiffies;
+	unsigned long elapsed = now - link->traffic_time;
+	u32 tx_pps = 0;
+	u32 rx_pps = 0;
+	int i;
+
+	rtl_data_stats_read(rtlpriv, &now_stats);
+
+	link->traffic_time = now;
+	elapsed = clamp_t(unsigned long, elapsed, 1, UINT_MAX);
+
+	rtlpriv->stats.txbytesunicast = now_stats.tx_bytes_unicast;
+	rtlpriv->stats.rxbytesunicast = now_stats.rx_bytes_unicast;
+	link->num_tx_inperiod = now_stats.tx_data - last->tx_data;
+	link->num_rx_inperiod = now_stats.rx_data - last->rx_data;
+	for (i = 0; i < MAX_TID_COUNT; i++)
+		link->tidtx_inperiod[i] = now_stats.tidtx[i] - last->tidtx[i];
+
+	for (i = 0; i < IEEE80211_NUM_ACS; i++) {
+		struct rtl_traffic_ac *ac = &link->ac[i];
+
+		ac->tx_pps = _rtl_traffic_ewma(ac->tx_pps,
+			_rtl_traffic_rate(now_stats.tx_pkts[i] -
+					  last->tx_pkts[i], elapsed));
+		ac->rx_pps = _rtl_traffic_ewma(ac->rx_pps,
+			_rtl_traffic_rate(now_stats.rx_pkts[i] -
+					  last->rx_pkts[i], elapsed));
+		ac->tx_byte_rate = _rtl_traffic_ewma(ac->tx_byte_rate,
+			_rtl_traffic_rate(now_stats.tx_bytes[i] -
+					  last->tx_bytes[i], elapsed));
+		ac->rx_byte_rate = _rtl_traffic_ewma(ac->rx_byte_rate,
+			_rtl_traffic_rate(now_stats.rx_bytes[i] -
+					  last->rx_bytes[i], elapsed));
+
+		tx_pps += ac->tx_pps >> RTL_TRAFFIC_EWMA_SHIFT;
+		rx_pps += ac->rx_pps >> RTL_TRAFFIC_EWMA_SHIFT;
+	}
+
+	link->tx_pps = tx_pps;
+	link->rx_pps = rx_pps;
+	*last = now_stats;
+}
+EXPORT_SYMBOL_GPL(rtl_traffic_update);
+
+/* this function is used for roaming */
+void rtl_beacon_statistic(struct ieee80211_hw *hw,
+			  struct rtl_rx_mgmt *rx_mgmt)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+
+	if (rtlpriv->mac80211.opmode != NL80211_IFTYPE_STATION)
+		return;
+
+	if (rtlpriv->mac80211.link_state < MAC80211_LINKED)
 		return;
 
 	/* and only beacons from the associated BSSID, please */
-	if (!ether_addr_equal(hdr->addr3, rtlpriv->mac80211.bssid))
+	if (!rx_mgmt->bcn || !rx_mgmt->has_ies || !rx_mgmt->from_bssid)
 		return;
 
 	rtlpriv->link_info.bcn_rx_inperiod++;
 }
 EXPORT_SYMBOL_GPL(rtl_beacon_statistic);
 
+static struct kmem_cache *rtl_bssid_cache;
+
+static u32 _rtl_scan_list_hash(const u8 *bssid)
+{
+	return jhash(bssid, ETH_ALEN, 0);
+}
+
+static void _rtl_scan_list_del(struct rtl_priv *rtlpriv,
+			       struct rtl_bssid_entry *entry)
+{
+	hash_del(&entry->hnode);
+	list_del(&entry->list);
+	kmem_cache_free(rtl_bssid_cache, entry);
+	rtlpriv->scan_list.num--;
+}
+
 static void rtl_free_entries_from_scan_list(struct ieee80211_hw *hw)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_bssid_entry *entry, *next;
 
-	list_for_each_entry_safe(entry, next, &rtlpriv->scan_list.list, list) {
-		list_del(&entry->list);
-		kfree(entry);
-		rtlpriv->scan_list.num--;
-	}
+	list_for_each_entry_safe(entry, next, &rtlpriv->scan_list.list, list)
+		_rtl_scan_list_del(rtlpriv, entry);
 }
 
 void rtl_scan_list_expire(struct ieee80211_hw *hw)
@@ -1859,76 +2367,85 @@ void rtl_scan_list_expire(struct ieee80211_hw *hw)
 
 	spin_lock_irqsave(&rtlpriv->locks.scan_list_lock, flags);
 
+	/* the list is sorted by age, so stop at the first fresh entry */
 	list_for_each_entry_safe(entry, next, &rtlpriv->scan_list.list, list) {
 
 		/* 180 seconds */
 		if (jiffies_to_msecs(jiffies - entry->age) < 180000)
-			continue;
-
-		list_del(&entry->list);
-		kfree(entry);
-		rtlpriv->scan_list.num--;
+			break;
 
 		RT_TRACE(rtlpriv, COMP_SCAN, DBG_LOUD,
 			 "BSSID=%pM is expire in scan list (total=%d)\n",
-			 entry->bssid, rtlpriv->scan_list.num);
+			 entry->bssid, rtlpriv->scan_list.num - 1);
+
+		_rtl_scan_list_del(rtlpriv, entry);
 	}
 
-	spin_unlock_irqrestore(&rtlpriv->locks.scan_list_lock, flags);
+	rtlpriv->btcoexist.btc_info.ap_num = min_t(u32, rtlpriv->scan_list.num,
+						     U8_MAX);
 
-	rtlpriv->btcoexist.btc_info.ap_num = rtlpriv->scan_list.num;
+	spin_unlock_irqrestore(&rtlpriv->locks.scan_list_lock, flags);
 }
 
-void rtl_collect_scan_list(struct ieee80211_hw *hw, struct sk_buff *skb)
+void rtl_collect_scan_list(struct ieee80211_hw *hw,
+			   struct rtl_rx_mgmt *rx_mgmt)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
-	struct ieee80211_hdr *hdr = (struct ieee80211_hdr *)skb->data;
+	struct ieee80211_hdr *hdr = rx_mgmt->hdr;
 	struct rtl_mac *mac = rtl_mac(rtl_priv(hw));
+	struct rtl_scan_list *scan_list = &rtlpriv->scan_list;
 	unsigned long flags;
 
 	struct rtl_bssid_entry *entry;
-	bool entry_found = false;
+	u32 key;
 
 	/* check if it is scanning */
 	if (!mac->act_scanning)
 		return;
 
 	/* check if this really is a beacon */
-	if (!ieee80211_is_beacon(hdr->frame_control) &&
-		!ieee80211_is_probe_resp(hdr->frame_control))
+	if (!rx_mgmt->bcn)
 		return;
 
+	key = _rtl_scan_list_hash(hdr->addr3);
+
 	spin_lock_irqsave(&rtlpriv->locks.scan_list_lock, flags);
 
-	list_for_each_entry(entry, &rtlpriv->scan_list.list, list) {
-		if (memcmp(entry->bssid, hdr->addr3, ETH_ALEN) == 0) {
-			list_del_init(&entry->list);
-			entry_found = true;
+	hash_for_each_possible(scan_list->hash, entry, hnode, key) {
+		if (ether_addr_equal(entry->bssid, hdr->addr3)) {
 			RT_TRACE(rtlpriv, COMP_SCAN, DBG_LOUD,
 				 "Update BSSID=%pM to scan list (total=%d)\n",
-				 hdr->addr3, rtlpriv->scan_list.num);
-			break;
+				 hdr->addr3, scan_list->num);
+			goto update;
 		}
 	}
 
-	if (!entry_found) {
-
-		entry = kmalloc(sizeof(struct rtl_bssid_entry), GFP_ATOMIC);
-
+	if (scan_list->num >= RTL_SCAN_LIST_MAX) {
+		/* recycle the oldest one */
+		entry = list_first_entry(&scan_list->list,
+					 struct rtl_bssid_entry, list);
+		hash_del(&entry->hnode);
+		scan_list->recycled++;
+	} else {
+		entry = kmem_cache_alloc(rtl_bssid_cache, GFP_ATOMIC);
 		if (!entry)
 			goto label_err;
+		INIT_LIST_HEAD(&entry->list);
+		scan_list->num++;
+	}
 
-		memcpy(entry->bssid, hdr->addr3, ETH_ALEN);
-		rtlpriv->scan_list.num++;
+	memcpy(entry->bssid, hdr->addr3, ETH_ALEN);
+	hash_add(scan_list->hash, &entry->hnode, key);
+	rtlpriv->btcoexist.btc_info.ap_num = min_t(u32, scan_list->num,
+						     U8_MAX);
 
-		RT_TRACE(rtlpriv, COMP_SCAN, DBG_LOUD,
-			 "Add BSSID=%pM to scan list (total=%d)\n",
-			 hdr->addr3, rtlpriv->scan_list.num);
-	}
+	RT_TRACE(rtlpriv, COMP_SCAN, DBG_LOUD,
+		 "Add BSSID=%pM to scan list (total=%d)\n",
+		 hdr->addr3, scan_list->num);
 
+update:
 	entry->age = jiffies;
-
-	list_add_tail(&entry->list, &rtlpriv->scan_list.list);
+	list_move_tail(&entry->list, &scan_list->list);
 
 label_err:
 	spin_unlock_irqrestore(&rtlpriv->locks.scan_list_lock, flags);
@@ -1944,16 +2461,14 @@ void rtl_watchdog_wq_callback(void *data)
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_hal *rtlhal = rtl_hal(rtl_priv(hw));
 	struct rtl_mac *mac = rtl_mac(rtl_priv(hw));
+	struct rt_link_detect *link = &rtlpriv->link_info;
 	bool busytraffic = false;
 	bool tx_busy_traffic = false;
 	bool rx_busy_traffic = false;
 	bool higher_busytraffic = false;
 	bool higher_busyrxtraffic = false;
 	u8 idx, tid;
-	u32 rx_cnt_inp4eriod = 0;
-	u32 tx_cnt_inp4eriod = 0;
-	u32 aver_rx_cnt_inperiod = 0;
-	u32 aver_tx_cnt_inperiod = 0;
+	u32 max_pps;
 	u32 aver_tidtx_inperiod[MAX_TID_COUNT] = {0};
 	u32 tidtx_inp4eriod[MAX_TID_COUNT] = {0};
 
@@ -1971,44 +2486,29 @@ void rtl_watchdog_wq_callback(void *data)
 	/* <2> to check if traffic busy, if
 	 * busytraffic we don't change channel
 	 */
+	rtl_traffic_update(hw);
 	if (mac->link_state >= MAC80211_LINKED) {
+		max_pps = max(link->tx_pps, link->rx_pps);
 
-		/* (1) get aver_rx_cnt_inperiod & aver_tx_cnt_inperiod */
-		for (idx = 0; idx <= 2; idx++) {
-			rtlpriv->link_info.num_rx_in4period[idx] =
-			    rtlpriv->link_info.num_rx_in4period[idx + 1];
-			rtlpriv->link_info.num_tx_in4period[idx] =
-			    rtlpriv->link_info.num_tx_in4period[idx + 1];
-		}
-		rtlpriv->link_info.num_rx_in4period[3] =
-		    rtlpriv->link_info.num_rx_inperiod;
-		rtlpriv->link_info.num_tx_in4period[3] =
-		    rtlpriv->link_info.num_tx_inperiod;
-		for (idx = 0; idx <= 3; idx++) {
-			rx_cnt_inp4eriod +=
-			    rtlpriv->link_info.num_rx_in4period[idx];
-			tx_cnt_inp4eriod +=
-			    rtlpriv->link_info.num_tx_in4period[idx];
-		}
-		aver_rx_cnt_inperiod = rx_cnt_inp4eriod / 4;
-		aver_tx_cnt_inperiod = tx_cnt_inp4eriod / 4;
-
-		/* (2) check traffic busy */
-		if (aver_rx_cnt_inperiod > 100 || aver_tx_cnt_inperiod > 100) {
+		/* check traffic busy */
+		if (_rtl_traffic_busy(max_pps, RTL_TRAFFIC_BUSY_PPS,
+				      link->busytraffic)) {
 			busytraffic = true;
-			if (aver_rx_cnt_inperiod > aver_tx_cnt_inperiod)
+			if (link->rx_pps > link->tx_pps)
 				rx_busy_traffic = true;
 			else
 				tx_busy_traffic = false;
 		}
 
 		/* Higher Tx/Rx data. */
-		if (aver_rx_cnt_inperiod > 4000 ||
-		    aver_tx_cnt_inperiod > 4000) {
+		if (_rtl_traffic_busy(max_pps, RTL_TRAFFIC_HIGHER_PPS,
+				      link->higher_busytraffic)) {
 			higher_busytraffic = true;
 
 			/* Extremely high Rx data. */
-			if (aver_rx_cnt_inperiod > 5000)
+			if (_rtl_traffic_busy(link->rx_pps,
+					      RTL_TRAFFIC_HIGHER_RX_PPS,
+					      link->higher_busyrxtraffic))
 				higher_busyrxtraffic = true;
 		}
 
@@ -2036,24 +2536,11 @@ void rtl_watchdog_wq_callback(void *data)
 		/* PS is controlled by coex. */
 		if (rtlpriv->cfg->ops->get_btc_status() &&
 		    rtlpriv->btcoexist.btc_ops->btc_is_bt_ctrl_lps(rtlpriv))
-			goto label_lps_done;
-
-		if (((rtlpriv->link_info.num_rx_inperiod +
-		      rtlpriv->link_info.num_tx_inperiod) > 8) ||
-		    (rtlpriv->link_info.num_rx_inperiod > 2))
-			rtl_lps_leave(hw);
+			rtlpriv->psc.gov.lps = false;
 		else
-			rtl_lps_enter(hw);
-
-label_lps_done:
-		;
+			rtl_ps_gov_update(hw);
 	}
 
-	rtlpriv->link_info.num_rx_inperiod = 0;
-	rtlpriv->link_info.num_tx_inperiod = 0;
-	for (tid = 0; tid <= 7; tid++)
-		rtlpriv->link_info.tidtx_inperiod[tid] = 0;
-
 	rtlpriv->link_info.busytraffic = busytraffic;
 	rtlpriv->link_info.higher_busytraffic = higher_busytraffic;
 	rtlpriv->link_info.rx_busy_traffic = rx_busy_traffic;
@@ -2102,6 +2589,9 @@ label_lps_done:
 
 	/* <6> scan list */
 	rtl_scan_list_expire(hw);
+
+	/* <7> lost TX reports */
+	rtl_tx_report_expire(hw);
 }
 
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 15, 0)
@@ -2133,80 +2623,71 @@ void rtl_fwevt_wq_callback(void *data)
 	rtlpriv->cfg->ops->c2h_command_handle(hw);
 }
 
+/* Called from the RX path only; see struct rtl_c2hcmd_ring */
 void rtl_c2hcmd_enqueue(struct ieee80211_hw *hw, u8 tag, u8 len, u8 *val)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
-	unsigned long flags;
+	struct rtl_c2hcmd_ring *ring = &rtlpriv->c2hcmd_ring;
 	struct rtl_c2hcmd *c2hcmd;
+	u32 head = ring->head;
+	u32 tail = smp_load_acquire(&ring->tail);
 
-	c2hcmd = kmalloc(sizeof(*c2hcmd),
-			 in_interrupt() ? GFP_ATOMIC : GFP_ATOMIC);
-
-	if (!c2hcmd)
-		goto label_err;
-
-	c2hcmd->val = kmalloc(len,
-			      in_interrupt() ? GFP_ATOMIC : GFP_ATOMIC);
+	if (len > RTL_C2HCMD_MAX_LEN) {
+		ring->oversized++;
+		RT_TRACE(rtlpriv, COMP_CMD, DBG_WARNING,
+			 "C2H cmd %#x too long: %d\n", tag, len);
+		return;
+	}
 
-	if (!c2hcmd->val)
-		goto label_err2;
+	if (head - tail >= RTL_C2HCMD_RING_SIZE) {
+		ring->overflows++;
+		RT_TRACE(rtlpriv, COMP_CMD, DBG_WARNING,
+			 "C2H cmd ring full, drop %#x\n", tag);
+		goto wake;
+	}
 
 	/* fill data */
+	c2hcmd = &ring->slot[head % RTL_C2HCMD_RING_SIZE];
 	c2hcmd->tag = tag;
 	c2hcmd->len = len;
 	memcpy(c2hcmd->val, val, len);
 
-	/* enqueue */
-	spin_lock_irqsave(&rtlpriv->locks.c2hcmd_lock, flags);
-
-	list_add_tail(&c2hcmd->list, &rtlpriv->c2hcmd_list);
+	/* publish the slot */
+	smp_store_release(&ring->head, head + 1);
+	ring->enqueued++;
+	if (head + 1 - tail > ring->max_depth)
+		ring->max_depth = head + 1 - tail;
 
-	spin_unlock_irqrestore(&rtlpriv->locks.c2hcmd_lock, flags);
-
-	/* wake up wq */
+wake:
 	queue_delayed_work(rtlpriv->works.rtl_wq, &rtlpriv->works.c2hcmd_wq, 0);
-
-	return;
-
-label_err2:
-	kfree(c2hcmd);
-
-label_err:
-	RT_TRACE(rtlpriv, COMP_CMD, DBG_WARNING,
-		 "C2H cmd enqueue fail.\n");
 }
 EXPORT_SYMBOL(rtl_c2hcmd_enqueue);
 
+/* Drains everything queued so far; the slots are handed back one by one
+ * so the producer can refill them while the batch is still running.
+ */
 void rtl_c2hcmd_launcher(struct ieee80211_hw *hw, int exec)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
-	unsigned long flags;
+	struct rtl_c2hcmd_ring *ring = &rtlpriv->c2hcmd_ring;
 	struct rtl_c2hcmd *c2hcmd;
+	u32 tail = ring->tail;
+	u32 head;
 
-	while (true) {
-		/* dequeue a task */
-		spin_lock_irqsave(&rtlpriv->locks.c2hcmd_lock, flags);
-
-		c2hcmd = list_first_entry_or_null(&rtlpriv->c2hcmd_list,
-						  struct rtl_c2hcmd, list);
-
-		if (c2hcmd)
-			list_del(&c2hcmd->list);
-
-		spin_unlock_irqrestore(&rtlpriv->locks.c2hcmd_lock, flags);
+	while ((head = smp_load_acquire(&ring->head)) != tail) {
+		if (head - tail > ring->max_batch)
+			ring->max_batch = head - tail;
 
-		/* do it */
-		if (!c2hcmd)
-			break;
+		do {
+			c2hcmd = &ring->slot[tail % RTL_C2HCMD_RING_SIZE];
 
-		if (rtlpriv->cfg->ops->c2h_content_parsing && exec)
-			rtlpriv->cfg->ops->c2h_content_parsing(hw,
+			if (rtlpriv->cfg->ops->c2h_content_parsing && exec)
+				rtlpriv->cfg->ops->c2h_content_parsing(hw,
 					c2hcmd->tag, c2hcmd->len, c2hcmd->val);
 
-		/* free */
-		kfree(c2hcmd->val);
-
-		kfree(c2hcmd);
+			smp_store_release(&ring->tail, ++tail);
+			ring->processed++;
+		} while (tail != head);
 	}
 }
 
@@ -2472,36 +2953,42 @@ static bool rtl_chk_vendor_ouisub(struct ieee80211_hw *hw,
 	return matched;
 }
 
-static bool rtl_find_221_ie(struct ieee80211_hw *hw, u8 *data,
-		unsigned int len)
+static bool rtl_find_221_ie(struct ieee80211_hw *hw,
+			    struct rtl_rx_mgmt *rx_mgmt)
 {
-	struct ieee80211_mgmt *mgmt = (void *)data;
 	struct octet_string vendor_ie;
 	u8 *pos, *end;
+	u8 i;
 
-	pos = (u8 *)mgmt->u.beacon.variable;
-	end = data + len;
-	while (pos < end) {
-		if (pos[0] == 221) {
+	for (i = 0; i < rx_mgmt->num_vendor; i++) {
+		vendor_ie.length = rx_mgmt->vendor[i][1];
+		vendor_ie.octet = &rx_mgmt->vendor[i][2];
+		if (rtl_chk_vendor_ouisub(hw, vendor_ie))
+			return true;
+	}
+	if (!rx_mgmt->vendor_overflow)
+		return false;
+
+	/* the index is full, walk the elements behind its last entry */
+	pos = rx_mgmt->vendor[i - 1];
+	pos += 2 + pos[1];
+	end = (u8 *)rx_mgmt->hdr + rx_mgmt->len;
+	while (pos + 2 <= end && pos + 2 + pos[1] <= end) {
+		if (pos[0] == WLAN_EID_VENDOR_SPECIFIC) {
 			vendor_ie.length = pos[1];
 			vendor_ie.octet = &pos[2];
 			if (rtl_chk_vendor_ouisub(hw, vendor_ie))
 				return true;
 		}
-
-		if (pos + 2 + pos[1] > end)
-			return false;
-
 		pos += 2 + pos[1];
 	}
 	return false;
 }
 
-void rtl_recognize_peer(struct ieee80211_hw *hw, u8 *data, unsigned int len)
+void rtl_recognize_peer(struct ieee80211_hw *hw, struct rtl_rx_mgmt *rx_mgmt)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_mac *mac = rtl_mac(rtl_priv(hw));
-	struct ieee80211_hdr *hdr = (void *)data;
 	u32 vendor = PEER_UNKNOWN;
 
 	static u8 ap3_1[3] = { 0x00, 0x14, 0xbf };
@@ -2533,18 +3020,15 @@ void rtl_recognize_peer(struct ieee80211_hw *hw, u8 *data, unsigned int len)
 		return;
 
 	/* check if this really is a beacon */
-	if (!ieee80211_is_beacon(hdr->frame_control))
-		return;
-
-	/* min. beacon length + FCS_LEN */
-	if (len <= 40 + FCS_LEN)
+	if (!rx_mgmt->has_ies ||
+	    !ieee80211_is_beacon(rx_mgmt->hdr->frame_control))
 		return;
 
 	/* and only beacons from the associated BSSID, please */
-	if (!ether_addr_equal_64bits(hdr->addr3, rtlpriv->mac80211.bssid))
+	if (!rx_mgmt->from_bssid)
 		return;
 
-	if (rtl_find_221_ie(hw, data, len))
+	if (rtl_find_221_ie(hw, rx_mgmt))
 		vendor = mac->vendor;
 
 	if ((memcmp(mac->bssid, ap5_1, 3) == 0) ||
@@ -2595,6 +3079,10 @@ EXPORT_SYMBOL_GPL(rtl_global_var);
 
 static int __init rtl_core_module_init(void)
 {
+	rtl_bssid_cache = KMEM_CACHE(rtl_bssid_entry, 0);
+	if (!rtl_bssid_cache)
+		return -ENOMEM;
+
 	if (rtl_rate_control_register())
 		pr_err("rtl: Unable to register rtl_rc, use default RC !!\n");
 
@@ -2615,6 +3103,8 @@ static void __exit rtl_core_module_exit(void)
 
 	/* remove debugfs */
 	rtl_debugfs_remove_topdir();
+
+	kmem_cache_destroy(rtl_bssid_cache);
 }
 
 module_init(rtl_core_module_init);
@@ -112,6 +112,17 @@ enum ap_peer {
 #define SET_TX_DESC_SW_DEFINE(__pdesc, __val)	\
 	SET_BITS_TO_LE_4BYTE(__pdesc + 24, 0, 12, __val)
 
+/* C2H TX report, st is 0 for an acked frame */
+#define GET_TX_REPORT_SN(__c2h)				\
+	((((__c2h)[7] & 0x0F) << 8) | (__c2h)[6])
+#define GET_TX_REPORT_ST(__c2h)				\
+	(((__c2h)[0] & 0xC0) >> 6)
+#define GET_TX_REPORT_RETRY(__c2h)			\
+	((__c2h)[2] & 0x3F)
+
+/* frames without a report after this long are reported as lost */
+#define RTL_TX_REPORT_TIMEOUT_MS		1000
+
 int rtl_init_core(struct ieee80211_hw *hw);
 void rtl_deinit_core(struct ieee80211_hw *hw);
 void rtl_init_rx_config(struct ieee80211_hw *hw);
@@ -135,13 +146,27 @@ u8 rtl_is_special_data(struct ieee80211_hw *hw, struct sk_buff *skb, u8 is_tx,
 bool rtl_is_tx_report_skb(struct ieee80211_hw *hw, struct sk_buff *skb);
 void rtl_get_tx_report(struct rtl_tcb_desc *ptcb_desc, u8 *pdesc,
 		       struct ieee80211_hw *hw);
+void rtl_tx_report_prepare(struct ieee80211_hw *hw, struct sk_buff *skb,
+			   struct rtl_tcb_desc *ptcb_desc);
+bool rtl_tx_report_hold(struct ieee80211_hw *hw, struct sk_buff *skb);
 void rtl_tx_report_handler(struct ieee80211_hw *hw, u8 *tmp_buf,
 			   u8 c2h_cmd_len);
 bool rtl_check_tx_report_acked(struct ieee80211_hw *hw);
 void rtl_wait_tx_report_acked(struct ieee80211_hw *hw, u32 wait_ms);
 
-void rtl_beacon_statistic(struct ieee80211_hw *hw, struct sk_buff *skb);
-void rtl_collect_scan_list(struct ieee80211_hw *hw, struct sk_buff *skb);
+extern const char rtl_data_stats_strings[][ETH_GSTRING_LEN];
+void rtl_data_stats_read(struct rtl_priv *rtlpriv, struct rtl_data_stats *sum);
+void rtl_traffic_tx(struct ieee80211_hw *hw, struct sk_buff *skb);
+void rtl_traffic_rx(struct ieee80211_hw *hw, struct sk_buff *skb);
+void rtl_traffic_update(struct ieee80211_hw *hw);
+
+void rtl_parse_rx_mgmt(struct ieee80211_hw *hw, struct sk_buff *skb,
+		       struct rtl_rx_mgmt *rx_mgmt, bool ies);
+void rtl_rx_mgmt_done(struct ieee80211_hw *hw, struct rtl_rx_mgmt *rx_mgmt);
+void rtl_beacon_statistic(struct ieee80211_hw *hw,
+			  struct rtl_rx_mgmt *rx_mgmt);
+void rtl_collect_scan_list(struct ieee80211_hw *hw,
+			   struct rtl_rx_mgmt *rx_mgmt);
 void rtl_scan_list_expire(struct ieee80211_hw *hw);
 int rtl_tx_agg_start(struct ieee80211_hw *hw, struct ieee80211_vif *vif,
 	struct ieee80211_sta *sta, u16 tid, u16 *ssn);
@@ -169,7 +194,7 @@ int rtl_send_smps_action(struct ieee80211_hw *hw,
 		struct ieee80211_sta *sta,
 		enum ieee80211_smps_mode smps);
 u8 *rtl_find_ie(u8 *data, unsigned int len, u8 ie);
-void rtl_recognize_peer(struct ieee80211_hw *hw, u8 *data, unsigned int len);
+void rtl_recognize_peer(struct ieee80211_hw *hw, struct rtl_rx_mgmt *rx_mgmt);
 u8 rtl_tid_to_ac(u8 tid);
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 15, 0)
 void rtl_easy_concurrent_retrytimer_callback(struct timer_list *t);
@@ -25,6 +25,7 @@
 #include "wifi.h"
 #include "cam.h"
 #include <linux/export.h>
+#include <linux/jhash.h>
 
 void rtl_cam_reset_sec_info(struct ieee80211_hw *hw)
 {
@@ -38,78 +39,116 @@ void rtl_cam_reset_sec_info(struct ieee80211_hw *hw)
 	rtlpriv->sec.pairwise_key = NULL;
 }
 
+static void _rtl_cam_write_hw(struct rtl_priv *rtlpriv, u8 entry_no,
+			      u8 entry_i, u32 target_content)
+{
+	u32 target_command;
+
+	target_command = entry_i + CAM_CONTENT_COUNT * entry_no;
+	target_command = target_command | BIT(31) | BIT(16);
+
+	rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[WCAMI], target_content);
+	rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[RWCAM], target_command);
+	rtlpriv->sec.cam_writes++;
+
+	RT_TRACE(rtlpriv, COMP_SEC, DBG_LOUD,
+		 "WRITE %x: %x\n", rtlpriv->cfg->maps[WCAMI], target_content);
+	RT_TRACE(rtlpriv, COMP_SEC, DBG_LOUD,
+		 "WRITE %x: %x\n", rtlpriv->cfg->maps[RWCAM], target_command);
+}
+
+/* Sets one dword of a CAM entry through the shadow. Once the whole entry
+ * is known (cam_synced), dwords that already hold the value are skipped.
+ * Inside rtl_cam_batch_begin/end the write waits for the end.
+ * The callers hold conf_mutex.
+ */
+static void _rtl_cam_write(struct rtl_priv *rtlpriv, u8 entry_no,
+			   u8 entry_i, u32 target_content)
+{
+	struct rtl_security *sec = &rtlpriv->sec;
+
+	if ((sec->cam_synced & BIT(entry_no)) &&
+	    sec->cam_shadow[entry_no][entry_i] == target_content) {
+		sec->cam_skipped++;
+		return;
+	}
+
+	sec->cam_shadow[entry_no][entry_i] = target_content;
+	if (sec->cam_batch) {
+		sec->cam_dirty[entry_no] |= BIT(entry_i);
+		return;
+	}
+	_rtl_cam_write_hw(rtlpriv, entry_no, entry_i, target_content);
+}
+
+void rtl_cam_batch_begin(struct ieee80211_hw *hw)
+{
+	rtl_priv(hw)->sec.cam_batch++;
+}
+EXPORT_SYMBOL(rtl_cam_batch_begin);
+
+/* Writes what changed during the batch. Within an entry the config dword
+ * goes last, as in rtl_cam_program_entry(), so the entry only turns valid
+ * once its key is complete.
+ */
+void rtl_cam_batch_end(struct ieee80211_hw *hw)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_security *sec = &rtlpriv->sec;
+	u8 entry_no;
+	s8 entry_i;
+
+	if (WARN_ON(!sec->cam_batch) || --sec->cam_batch)
+		return;
+
+	for (entry_no = 0; entry_no < TOTAL_CAM_ENTRY; entry_no++) {
+		if (!sec->cam_dirty[entry_no])
+			continue;
+
+		for (entry_i = CAM_CONTENT_COUNT - 1; entry_i >= 0; entry_i--)
+			if (sec->cam_dirty[entry_no] & BIT(entry_i))
+				_rtl_cam_write_hw(rtlpriv, entry_no, entry_i,
+					sec->cam_shadow[entry_no][entry_i]);
+		sec->cam_dirty[entry_no] = 0;
+	}
+}
+EXPORT_SYMBOL(rtl_cam_batch_end);
+
 static void rtl_cam_program_entry(struct ieee80211_hw *hw, u32 entry_no,
 			   u8 *mac_addr, u8 *key_cont_128, u16 us_config)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 
-	u32 target_command;
 	u32 target_content = 0;
 	s8 entry_i;
 
 	RT_PRINT_DATA(rtlpriv, COMP_SEC, DBG_DMESG, "Key content :",
 		      key_cont_128, 16);
+	RT_TRACE(rtlpriv, COMP_SEC, DBG_LOUD,
+		 "The Key ID is %d\n", entry_no);
 
 	/* 0-1 config + mac, 2-5 fill 128key,6-7 are reserved */
 	for (entry_i = CAM_CONTENT_COUNT - 1; entry_i >= 0; entry_i--) {
-		target_command = entry_i + CAM_CONTENT_COUNT * entry_no;
-		target_command = target_command | BIT(31) | BIT(16);
-
 		if (entry_i == 0) {
 			target_content = (u32) (*(mac_addr + 0)) << 16 |
 			    (u32) (*(mac_addr + 1)) << 24 | (u32) us_config;
-
-			rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[WCAMI],
-					target_content);
-			rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[RWCAM],
-					target_command);
-
-			RT_TRACE(rtlpriv, COMP_SEC, DBG_LOUD,
-				 "WRITE %x: %x\n",
-				 rtlpriv->cfg->maps[WCAMI], target_content);
-			RT_TRACE(rtlpriv, COMP_SEC, DBG_LOUD,
-				 "The Key ID is %d\n", entry_no);
-			RT_TRACE(rtlpriv, COMP_SEC, DBG_LOUD,
-				 "WRITE %x: %x\n",
-				 rtlpriv->cfg->maps[RWCAM], target_command);
-
 		} else if (entry_i == 1) {
-
 			target_content = (u32) (*(mac_addr + 5)) << 24 |
 			    (u32) (*(mac_addr + 4)) << 16 |
 			    (u32) (*(mac_addr + 3)) << 8 |
 			    (u32) (*(mac_addr + 2));
-
-			rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[WCAMI],
-					target_content);
-			rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[RWCAM],
-					target_command);
-
-			RT_TRACE(rtlpriv, COMP_SEC, DBG_LOUD,
-				 "WRITE A4: %x\n", target_content);
-			RT_TRACE(rtlpriv, COMP_SEC, DBG_LOUD,
-				 "WRITE A0: %x\n", target_command);
-
 		} else {
-
 			target_content =
 			    (u32) (*(key_cont_128 + (entry_i * 4 - 8) + 3)) <<
 			    24 | (u32) (*(key_cont_128 + (entry_i * 4 - 8) + 2))
 			    << 16 |
 			    (u32) (*(key_cont_128 + (entry_i * 4 - 8) + 1)) << 8
 			    | (u32) (*(key_cont_128 + (entry_i * 4 - 8) + 0));
-
-			rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[WCAMI],
-					target_content);
-			rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[RWCAM],
-					target_command);
-
-			RT_TRACE(rtlpriv, COMP_SEC, DBG_LOUD,
-				 "WRITE A4: %x\n", target_content);
-			RT_TRACE(rtlpriv, COMP_SEC, DBG_LOUD,
-				 "WRITE A0: %x\n", target_command);
 		}
+
+		_rtl_cam_write(rtlpriv, entry_no, entry_i, target_content);
 	}
+	rtlpriv->sec.cam_synced |= BIT(entry_no);
 
 	RT_TRACE(rtlpriv, COMP_SEC, DBG_LOUD,
 		 "after set key, usconfig:%x\n", us_config);
@@ -151,21 +190,14 @@ EXPORT_SYMBOL(rtl_cam_add_one_entry);
 int rtl_cam_delete_one_entry(struct ieee80211_hw *hw,
 			     u8 *mac_addr, u32 ul_key_id)
 {
-	u32 ul_command;
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 
 	RT_TRACE(rtlpriv, COMP_SEC, DBG_DMESG, "key_idx:%d\n", ul_key_id);
 
-	ul_command = ul_key_id * CAM_CONTENT_COUNT;
-	ul_command = ul_command | BIT(31) | BIT(16);
-
-	rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[WCAMI], 0);
-	rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[RWCAM], ul_command);
+	if (ul_key_id >= TOTAL_CAM_ENTRY)
+		return 0;
 
-	RT_TRACE(rtlpriv, COMP_SEC, DBG_DMESG,
-		 "rtl_cam_delete_one_entry(): WRITE A4: %x\n", 0);
-	RT_TRACE(rtlpriv, COMP_SEC, DBG_DMESG,
-		 "rtl_cam_delete_one_entry(): WRITE A0: %x\n", ul_command);
+	_rtl_cam_write(rtlpriv, ul_key_id, 0, 0);
 
 	return 0;
 
@@ -179,6 +211,11 @@ void rtl_cam_reset_all_entry(struct ieee80211_hw *hw)
 
 	ul_command = BIT(31) | BIT(30);
 	rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[RWCAM], ul_command);
+
+	/* only the valid bits are known to be clear afterwards */
+	memset(rtlpriv->sec.cam_shadow, 0, sizeof(rtlpriv->sec.cam_shadow));
+	memset(rtlpriv->sec.cam_dirty, 0, sizeof(rtlpriv->sec.cam_dirty));
+	rtlpriv->sec.cam_synced = 0;
 }
 EXPORT_SYMBOL(rtl_cam_reset_all_entry);
 
@@ -186,7 +223,6 @@ void rtl_cam_mark_invalid(struct ieee80211_hw *hw, u8 uc_index)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 
-	u32 ul_command;
 	u32 ul_content;
 	u32 ul_enc_algo = rtlpriv->cfg->maps[SEC_CAM_AES];
 
@@ -210,16 +246,11 @@ void rtl_cam_mark_invalid(struct ieee80211_hw *hw, u8 uc_index)
 	ul_content = (uc_index & 3) | ((u16) (ul_enc_algo) << 2);
 
 	ul_content |= BIT(15);
-	ul_command = CAM_CONTENT_COUNT * uc_index;
-	ul_command = ul_command | BIT(31) | BIT(16);
-
-	rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[WCAMI], ul_content);
-	rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[RWCAM], ul_command);
 
 	RT_TRACE(rtlpriv, COMP_SEC, DBG_DMESG,
-		 "rtl_cam_mark_invalid(): WRITE A4: %x\n", ul_content);
-	RT_TRACE(rtlpriv, COMP_SEC, DBG_DMESG,
-		 "rtl_cam_mark_invalid(): WRITE A0: %x\n", ul_command);
+		 "rtl_cam_mark_invalid(): entry %d: %x\n", uc_index, ul_content);
+
+	_rtl_cam_write(rtlpriv, uc_index, 0, ul_content);
 }
 EXPORT_SYMBOL(rtl_cam_mark_invalid);
 
@@ -227,7 +258,6 @@ void rtl_cam_empty_entry(struct ieee80211_hw *hw, u8 uc_index)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 
-	u32 ul_command;
 	u32 ul_content;
 	u32 ul_encalgo = rtlpriv->cfg->maps[SEC_CAM_AES];
 	u8 entry_i;
@@ -260,61 +290,73 @@ void rtl_cam_empty_entry(struct ieee80211_hw *hw, u8 uc_index)
 			ul_content = 0;
 		}
 
-		ul_command = CAM_CONTENT_COUNT * uc_index + entry_i;
-		ul_command = ul_command | BIT(31) | BIT(16);
+		_rtl_cam_write(rtlpriv, uc_index, entry_i, ul_content);
+	}
+	rtlpriv->sec.cam_synced |= BIT(uc_index);
+}
+EXPORT_SYMBOL(rtl_cam_empty_entry);
 
-		rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[WCAMI], ul_content);
-		rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[RWCAM], ul_command);
+static u32 _rtl_cam_sta_hash(const u8 *sta_addr)
+{
+	return jhash(sta_addr, ETH_ALEN, 0);
+}
 
-		RT_TRACE(rtlpriv, COMP_SEC, DBG_LOUD,
-			 "rtl_cam_empty_entry(): WRITE A4: %x\n",
-			 ul_content);
-		RT_TRACE(rtlpriv, COMP_SEC, DBG_LOUD,
-			 "rtl_cam_empty_entry(): WRITE A0: %x\n",
-			 ul_command);
+static u8 _rtl_cam_find_sta(struct rtl_priv *rtlpriv, u8 *sta_addr)
+{
+	struct rtl_security *sec = &rtlpriv->sec;
+	u32 key = _rtl_cam_sta_hash(sta_addr);
+	struct hlist_head *head;
+	struct hlist_node *node;
+	u8 i;
+
+	head = &sec->cam_sta_hash[hash_min(key, HASH_BITS(sec->cam_sta_hash))];
+	hlist_for_each(node, head) {
+		i = node - sec->cam_sta_node;
+		if (ether_addr_equal_unaligned(sec->hwsec_cam_sta_addr[i],
+					       sta_addr))
+			return i;
 	}
-
+	return TOTAL_CAM_ENTRY;
 }
-EXPORT_SYMBOL(rtl_cam_empty_entry);
 
 u8 rtl_cam_get_free_entry(struct ieee80211_hw *hw, u8 *sta_addr)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
-	u32 bitmap = (rtlpriv->sec.hwsec_cam_bitmap) >> 4;
-	u8 entry_idx = 0;
-	u8 i, *addr;
+	struct rtl_security *sec = &rtlpriv->sec;
+	/* 0-3 are the default keys */
+	u32 used = sec->hwsec_cam_bitmap | GENMASK(3, 0);
+	u8 entry_idx;
 
 	if (NULL == sta_addr) {
 		pr_err("sta_addr is NULL.\n");
 		return TOTAL_CAM_ENTRY;
 	}
 	/* Does STA already exist? */
-	for (i = 4; i < TOTAL_CAM_ENTRY; i++) {
-		addr = rtlpriv->sec.hwsec_cam_sta_addr[i];
-		if (ether_addr_equal_unaligned(addr, sta_addr))
-			return i;
-	}
+	entry_idx = _rtl_cam_find_sta(rtlpriv, sta_addr);
+	if (entry_idx < TOTAL_CAM_ENTRY)
+		return entry_idx;
+
 	/* Get a free CAM entry. */
-	for (entry_idx = 4; entry_idx < TOTAL_CAM_ENTRY; entry_idx++) {
-		if ((bitmap & BIT(0)) == 0) {
-			pr_err("-----hwsec_cam_bitmap: 0x%x entry_idx=%d\n",
-			       rtlpriv->sec.hwsec_cam_bitmap, entry_idx);
-			rtlpriv->sec.hwsec_cam_bitmap |= BIT(0) << entry_idx;
-			memcpy(rtlpriv->sec.hwsec_cam_sta_addr[entry_idx],
-			       sta_addr, ETH_ALEN);
-			return entry_idx;
-		}
-		bitmap = bitmap >> 1;
-	}
-	return TOTAL_CAM_ENTRY;
+	if (used == ~0U)
+		return TOTAL_CAM_ENTRY;
+
+	entry_idx = ffz(used);
+	RT_TRACE(rtlpriv, COMP_SEC, DBG_DMESG,
+		 "hwsec_cam_bitmap: 0x%x entry_idx=%d\n",
+		 sec->hwsec_cam_bitmap, entry_idx);
+	sec->hwsec_cam_bitmap |= BIT(entry_idx);
+	memcpy(sec->hwsec_cam_sta_addr[entry_idx], sta_addr, ETH_ALEN);
+	hash_add(sec->cam_sta_hash, &sec->cam_sta_node[entry_idx],
+		 _rtl_cam_sta_hash(sta_addr));
+	return entry_idx;
 }
 EXPORT_SYMBOL(rtl_cam_get_free_entry);
 
 void rtl_cam_del_entry(struct ieee80211_hw *hw, u8 *sta_addr)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
-	u32 bitmap;
-	u8 i, *addr;
+	struct rtl_security *sec = &rtlpriv->sec;
+	u8 i;
 
 	if (NULL == sta_addr) {
 		pr_err("sta_addr is NULL.\n");
@@ -326,18 +368,15 @@ void rtl_cam_del_entry(struct ieee80211_hw *hw, u8 *sta_addr)
 		return;
 	}
 	/* Does STA already exist? */
-	for (i = 4; i < TOTAL_CAM_ENTRY; i++) {
-		addr = rtlpriv->sec.hwsec_cam_sta_addr[i];
-		bitmap = (rtlpriv->sec.hwsec_cam_bitmap) >> i;
-		if (((bitmap & BIT(0)) == BIT(0)) &&
-		    (ether_addr_equal_unaligned(addr, sta_addr))) {
-			/* Remove from HW Security CAM */
-			eth_zero_addr(rtlpriv->sec.hwsec_cam_sta_addr[i]);
-			rtlpriv->sec.hwsec_cam_bitmap &= ~(BIT(0) << i);
-			RT_TRACE(rtlpriv, COMP_SEC, DBG_DMESG,
-				 "&&&&&&&&&del entry %d\n", i);
-		}
-	}
-	return;
+	i = _rtl_cam_find_sta(rtlpriv, sta_addr);
+	if (i >= TOTAL_CAM_ENTRY)
+		return;
+
+	/* Remove from HW Security CAM */
+	hash_del(&sec->cam_sta_node[i]);
+	eth_zero_addr(sec->hwsec_cam_sta_addr[i]);
+	sec->hwsec_cam_bitmap &= ~BIT(i);
+	RT_TRACE(rtlpriv, COMP_SEC, DBG_DMESG,
+		 "&&&&&&&&&del entry %d\n", i);
 }
 EXPORT_SYMBOL(rtl_cam_del_entry);
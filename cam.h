@@ -26,8 +26,6 @@
 #ifndef __RTL_CAM_H_
 #define __RTL_CAM_H_
 
-#define CAM_CONTENT_COUNT				8
-
 #define CFG_VALID					BIT(15)
 
 #define PAIRWISE_KEYIDX					0
@@ -46,5 +44,7 @@ void rtl_cam_empty_entry(struct ieee80211_hw *hw, u8 uc_index);
 void rtl_cam_reset_sec_info(struct ieee80211_hw *hw);
 u8 rtl_cam_get_free_entry(struct ieee80211_hw *hw, u8 *sta_addr);
 void rtl_cam_del_entry(struct ieee80211_hw *hw, u8 *sta_addr);
+void rtl_cam_batch_begin(struct ieee80211_hw *hw);
+void rtl_cam_batch_end(struct ieee80211_hw *hw);
 
 #endif
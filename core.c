@@ -28,13 +28,30 @@
 #include "cam.h"
 #include "base.h"
 #include "ps.h"
+#include "rc.h"
 #include "pwrseqcmd.h"
 
 #include "btcoexist/rtl_btc.h"
 #include <linux/firmware.h>
 #include <linux/export.h>
+#include <linux/moduleparam.h>
 #include <net/cfg80211.h>
 
+static uint rtl_key_wait_ms = 500;
+module_param_named(key_wait_ms, rtl_key_wait_ms, uint, 0644);
+MODULE_PARM_DESC(key_wait_ms, "Max ms to wait for the TX report of the last frame before a key is removed (default 500)\n");
+
+static uint rtl_cal_max_age = 600;
+module_param_named(cal_max_age, rtl_cal_max_age, uint, 0644);
+MODULE_PARM_DESC(cal_max_age, "Seconds a cached IQK result is reapplied instead of calibrating, 0 to always calibrate (default 600)\n");
+
+static uint rtl_pwrseq_prog = 1;
+module_param_named(pwrseq_prog, rtl_pwrseq_prog, uint, 0644);
+MODULE_PARM_DESC(pwrseq_prog, "Run power sequences as programs compiled for the chip, 0 to interpret the tables (default 1)\n");
+
+/* the interpreter allowed 5000 polls of 10 us per sequence */
+#define RTL_PWRSEQ_POLL_US	50000
+
 u8 channel5g[CHANNEL_MAX_NUMBER_5G] = {
 	36, 38, 40, 42, 44, 46, 48,		/* Band 1 */
 	52, 54, 56, 58, 60, 62, 64,		/* Band 2 */
@@ -91,6 +108,394 @@ void rtl_bb_delay(struct ieee80211_hw *hw, u32 addr, u32 data)
 }
 EXPORT_SYMBOL(rtl_bb_delay);
 
+/*********************************************************
+ *
+ * register tables compiled per board
+ *
+ *********************************************************/
+#define RTL_PHY_COND_ELSE	2
+#define RTL_PHY_COND_ENDIF	3
+
+static u32 _rtl_phy_prog_delay_us(enum rtl_phy_write type, u32 addr)
+{
+	if (type == RTL_PHY_WRITE_RF)
+		return (addr == 0xfe || addr == 0xffe) ? 50000 : 0;
+	if (type != RTL_PHY_WRITE_BB)
+		return 0;
+
+	switch (addr) {
+	case 0xfe:
+		return 50000;
+	case 0xfd:
+		return 5000;
+	case 0xfc:
+		return 1000;
+	case 0xfb:
+		return 50;
+	case 0xfa:
+		return 5;
+	case 0xf9:
+		return 1;
+	}
+	return 0;
+}
+
+/* The tables are (addr, data) pairs, with if/else if/else/endif records
+ * in between that select entries by board. Picks the entries for this
+ * board and folds the delay records into the write before them. With
+ * prog NULL it only counts the writes.
+ */
+static u32 _rtl_phy_prog_resolve(struct ieee80211_hw *hw,
+				 struct rtl_phy_prog *prog,
+				 enum rtl_phy_write type,
+				 const u32 *table, u32 len,
+				 bool (*check)(struct ieee80211_hw *hw,
+					       u32 cond1, u32 cond2))
+{
+	bool matched = true, skipped = false;
+	u32 mask = type == RTL_PHY_WRITE_BYTE ? MASKBYTE0 :
+		   type == RTL_PHY_WRITE_RF ? RFREG_OFFSET_MASK : MASKDWORD;
+	/* RF writes need time to go out on the 3-wire bus */
+	u32 settle_us = type == RTL_PHY_WRITE_RF ? 1 : 0;
+	u32 n = 0;
+	u32 i;
+
+	for (i = 0; i + 1 < len; i += 2) {
+		u32 v1 = table[i];
+		u32 v2 = table[i + 1];
+		u32 delay_us;
+
+		if (v1 & BIT(31)) {
+			switch ((v1 & (BIT(29) | BIT(28))) >> 28) {
+			case RTL_PHY_COND_ENDIF:
+				matched = true;
+				skipped = false;
+				break;
+			case RTL_PHY_COND_ELSE:
+				matched = !skipped;
+				break;
+			default:
+				matched = !skipped && check(hw, v1, v2);
+				if (matched)
+					skipped = true;
+				break;
+			}
+			continue;
+		}
+		/* negative conditions are not used */
+		if ((v1 & BIT(30)) || !matched)
+			continue;
+
+		delay_us = _rtl_phy_prog_delay_us(type, v1);
+		if (delay_us) {
+			if (!prog)
+				continue;
+			if (n)
+				prog->ops[n - 1].delay_us += delay_us;
+			else
+				prog->lead_delay_us += delay_us;
+			continue;
+		}
+
+		if (prog) {
+			prog->ops[n].addr = v1;
+			prog->ops[n].mask = mask;
+			prog->ops[n].data = v2;
+			prog->ops[n].delay_us = settle_us;
+		}
+		n++;
+	}
+
+	return n;
+}
+
+static struct rtl_phy_prog *
+_rtl_phy_prog_compile(struct ieee80211_hw *hw, enum rtl_phy_write type,
+		      enum radio_path rfpath, const u32 *table, u32 len,
+		      bool (*check)(struct ieee80211_hw *hw,
+				    u32 cond1, u32 cond2))
+{
+	struct rtl_phy_prog *prog;
+	u64 start = ktime_get_ns();
+	u32 n;
+
+	n = _rtl_phy_prog_resolve(hw, NULL, type, table, len, check);
+	/* IPS brings the NIC up under a spinlock */
+	prog = kzalloc(sizeof(*prog) + n * sizeof(prog->ops[0]), GFP_ATOMIC);
+	if (!prog)
+		return NULL;
+
+	prog->type = type;
+	prog->rfpath = rfpath;
+	prog->entries = len / 2;
+	prog->len = _rtl_phy_prog_resolve(hw, prog, type, table, len, check);
+	prog->compile_ns = ktime_get_ns() - start;
+	return prog;
+}
+
+static void _rtl_phy_prog_wait(struct rtl_priv *rtlpriv, u32 delay_us)
+{
+	rtl_io_batch_flush(rtlpriv);
+	if (delay_us >= 1000)
+		mdelay(delay_us / 1000);
+	udelay(delay_us % 1000);
+}
+
+static void _rtl_phy_prog_run(struct ieee80211_hw *hw,
+			      struct rtl_phy_prog *prog)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	const struct rtl_phy_op *op = prog->ops;
+	const struct rtl_phy_op *end = op + prog->len;
+	u64 start = ktime_get_ns();
+	/* BB and RF writes go out one by one, only MAC bytes are combined */
+	bool batch = prog->type == RTL_PHY_WRITE_BYTE;
+
+	if (batch)
+		rtl_io_batch_begin(rtlpriv);
+	if (prog->lead_delay_us)
+		_rtl_phy_prog_wait(rtlpriv, prog->lead_delay_us);
+
+	switch (prog->type) {
+	case RTL_PHY_WRITE_BYTE:
+		for (; op < end; op++) {
+			rtl_write_byte(rtlpriv, op->addr, (u8)op->data);
+			if (op->delay_us)
+				_rtl_phy_prog_wait(rtlpriv, op->delay_us);
+		}
+		break;
+	case RTL_PHY_WRITE_BB:
+		for (; op < end; op++) {
+			rtl_set_bbreg(hw, op->addr, op->mask, op->data);
+			if (op->delay_us)
+				_rtl_phy_prog_wait(rtlpriv, op->delay_us);
+		}
+		break;
+	case RTL_PHY_WRITE_RF:
+		for (; op < end; op++) {
+			rtl_set_rfreg(hw, prog->rfpath, op->addr, op->mask,
+				      op->data);
+			if (op->delay_us)
+				_rtl_phy_prog_wait(rtlpriv, op->delay_us);
+		}
+		break;
+	}
+	if (batch)
+		rtl_io_batch_end(rtlpriv);
+
+	prog->run_ns = ktime_get_ns() - start;
+	prog->runs++;
+}
+
+/* Writes a register table. The first call resolves the board conditions
+ * of the table into a flat program, later ones (IPS wakeup, restart)
+ * only run that. Returns false if the program could not be allocated,
+ * the caller then walks the table itself.
+ */
+bool rtl_phy_prog_load(struct ieee80211_hw *hw, enum rtl_phy_prog_id id,
+		       const u32 *table, u32 len, enum rtl_phy_write type,
+		       enum radio_path rfpath,
+		       bool (*check)(struct ieee80211_hw *hw,
+				     u32 cond1, u32 cond2))
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_phy_prog *prog = rtlpriv->phy.prog[id];
+
+	if (!prog) {
+		prog = _rtl_phy_prog_compile(hw, type, rfpath, table, len,
+					     check);
+		if (!prog)
+			return false;
+		rtlpriv->phy.prog[id] = prog;
+		RT_TRACE(rtlpriv, COMP_INIT, DBG_LOUD,
+			 "phy prog %d: %u entries, %u writes, compiled in %llu ns\n",
+			 id, prog->entries, prog->len, prog->compile_ns);
+	}
+
+	_rtl_phy_prog_run(hw, prog);
+	return true;
+}
+EXPORT_SYMBOL_GPL(rtl_phy_prog_load);
+
+void rtl_phy_prog_free(struct ieee80211_hw *hw)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	int i;
+
+	for (i = 0; i < RTL_PHY_PROG_MAX; i++) {
+		kfree(rtlpriv->phy.prog[i]);
+		rtlpriv->phy.prog[i] = NULL;
+	}
+}
+EXPORT_SYMBOL_GPL(rtl_phy_prog_free);
+
+/* Power tracking stores the thermal meter reading in thermalvalue_iqk
+ * before it calibrates, while thermalvalue may only be updated after the
+ * IQK has run (88ee), so the former is what a result belongs to.
+ */
+static u8 _rtl_cal_thermal(struct rtl_priv *rtlpriv)
+{
+	/* not tracked yet right after power on */
+	if (rtlpriv->dm.thermalvalue_iqk)
+		return rtlpriv->dm.thermalvalue_iqk;
+	return rtlpriv->efuse.eeprom_thermalmeter;
+}
+
+static struct rtl_cal_entry *_rtl_cal_cache_slot(struct ieee80211_hw *hw,
+						 u8 thermal)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_phy *rtlphy = &rtlpriv->phy;
+	u8 channel = rtlphy->current_channel;
+	u8 bw = rtlphy->current_chan_bw;
+	u8 group;
+
+	if (!rtlphy->cal_cache || bw >= RTL_CAL_BW)
+		return NULL;
+
+	if (channel <= 5)
+		group = 0;
+	else if (channel <= 10)
+		group = 1;
+	else if (channel <= 14)
+		group = 2;
+	else if (channel <= 64)
+		group = 3;
+	else if (channel <= 144)
+		group = 4;
+	else
+		group = 5;
+
+	thermal = min_t(u8, thermal >> RTL_CAL_THERMAL_SHIFT,
+			RTL_CAL_THERMAL_BUCKETS - 1);
+	return &rtlphy->cal_cache[(group * RTL_CAL_BW + bw) *
+				  RTL_CAL_THERMAL_BUCKETS + thermal];
+}
+
+/* Returns the result of an earlier calibration on the current channel
+ * group, bandwidth and thermal bucket if it is younger than cal_max_age,
+ * so the caller can write it back instead of calibrating.
+ */
+struct rtl_cal_entry *rtl_cal_cache_get(struct ieee80211_hw *hw)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_cal_stats *stats = &rtlpriv->phy.cal_stats;
+	struct rtl_cal_entry *entry;
+
+	entry = _rtl_cal_cache_slot(hw, _rtl_cal_thermal(rtlpriv));
+	if (!entry || !entry->valid) {
+		stats->misses++;
+		return NULL;
+	}
+
+	if (!rtl_cal_max_age ||
+	    time_after(jiffies, entry->stamp + rtl_cal_max_age * HZ)) {
+		entry->valid = false;
+		stats->expired++;
+		return NULL;
+	}
+
+	stats->hits++;
+	stats->saved_ns += entry->cal_ns;
+	RT_TRACE(rtlpriv, COMP_IQK, DBG_LOUD,
+		 "IQK of thermal %d reused on channel %d\n",
+		 entry->thermal, rtlpriv->phy.current_channel);
+	return entry;
+}
+EXPORT_SYMBOL_GPL(rtl_cal_cache_get);
+
+void rtl_cal_cache_put(struct ieee80211_hw *hw, const u32 *val, u8 num,
+		       u64 cal_ns)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_phy *rtlphy = &rtlpriv->phy;
+	struct rtl_cal_entry *entry;
+	u8 thermal = _rtl_cal_thermal(rtlpriv);
+
+	rtlphy->cal_stats.cals++;
+	rtlphy->cal_stats.cal_ns += cal_ns;
+
+	if (WARN_ON_ONCE(num > RTL_CAL_VAL_NUM))
+		return;
+
+	/* IQK also runs from hw_init, which IPS calls under a spinlock */
+	if (!rtlphy->cal_cache)
+		rtlphy->cal_cache = kcalloc(RTL_CAL_CACHE_LEN,
+					    sizeof(struct rtl_cal_entry),
+					    GFP_ATOMIC);
+
+	entry = _rtl_cal_cache_slot(hw, thermal);
+	if (!entry)
+		return;
+
+	memcpy(entry->val, val, num * sizeof(u32));
+	entry->num = num;
+	entry->thermal = thermal;
+	entry->stamp = jiffies;
+	entry->cal_ns = cal_ns;
+	entry->valid = true;
+}
+EXPORT_SYMBOL_GPL(rtl_cal_cache_put);
+
+/* The 11n chips keep the winning IQK result row in reg_e94.. and
+ * iqk_matrix. The RX IQ registers in iqk_rx_reg[] are written back as they
+ * were, but the TX IQ imbalance registers also hold the OFDM swing in bits
+ * 31:22, which power tracking may have changed since. So the caller has to
+ * reapply result through its fill_iqk_matrix helpers to scale the TX IQC
+ * by the current swing.
+ */
+bool rtl_iqk_cache_reload(struct ieee80211_hw *hw, const u32 *iqk_rx_reg,
+			  u8 num, long *result)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_phy *rtlphy = &rtlpriv->phy;
+	struct rtl_cal_entry *entry;
+	u8 i;
+
+	entry = rtl_cal_cache_get(hw);
+	if (!entry || entry->num != num + IQK_MATRIX_REG_NUM)
+		return false;
+
+	for (i = 0; i < num; i++)
+		rtl_set_bbreg(hw, iqk_rx_reg[i], MASKDWORD, entry->val[i]);
+	for (i = 0; i < IQK_MATRIX_REG_NUM; i++)
+		result[i] = (s32)entry->val[num + i];
+
+	rtlphy->reg_e94 = result[0];
+	rtlphy->reg_e9c = result[1];
+	rtlphy->reg_eb4 = result[4];
+	rtlphy->reg_ebc = result[5];
+	return true;
+}
+EXPORT_SYMBOL_GPL(rtl_iqk_cache_reload);
+
+void rtl_iqk_cache_save(struct ieee80211_hw *hw, const u32 *iqk_rx_reg,
+			u8 num, const long *result, u64 start)
+{
+	u32 val[RTL_CAL_VAL_NUM];
+	u8 i;
+
+	if (WARN_ON_ONCE(num + IQK_MATRIX_REG_NUM > RTL_CAL_VAL_NUM))
+		return;
+
+	for (i = 0; i < num; i++)
+		val[i] = rtl_get_bbreg(hw, iqk_rx_reg[i], MASKDWORD);
+	for (i = 0; i < IQK_MATRIX_REG_NUM; i++)
+		val[num + i] = result[i];
+	rtl_cal_cache_put(hw, val, num + IQK_MATRIX_REG_NUM,
+			  ktime_get_ns() - start);
+}
+EXPORT_SYMBOL_GPL(rtl_iqk_cache_save);
+
+void rtl_cal_cache_free(struct ieee80211_hw *hw)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+
+	kfree(rtlpriv->phy.cal_cache);
+	rtlpriv->phy.cal_cache = NULL;
+}
+EXPORT_SYMBOL_GPL(rtl_cal_cache_free);
+
 static void rtl_fw_do_work(const struct firmware *firmware, void *context,
 			   bool is_wow)
 {
@@ -222,6 +627,8 @@ static void rtl_op_tx(struct ieee80211_hw *hw,
 	if (!test_bit(RTL_STATUS_INTERFACE_START, &rtlpriv->status))
 		goto err_free;
 
+	rtl_traffic_tx(hw, skb);
+
 	if (!rtlpriv->intf_ops->waitq_insert(hw, control->sta, skb))
 		rtlpriv->intf_ops->adapter_tx(hw, control->sta, skb, &tcb_desc);
 	return;
@@ -1378,6 +1785,42 @@ static void rtl_op_sta_notify(struct ieee80211_hw *hw,
 	}
 }
 
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
+static void rtl_op_sta_statistics(struct ieee80211_hw *hw,
+				  struct ieee80211_vif *vif,
+				  struct ieee80211_sta *sta,
+				  struct station_info *sinfo)
+{
+	/* the firmware picks the data rate, mac80211 can't know it */
+	if (rtl_rc_get_txrate(hw, sta, &sinfo->txrate))
+		sinfo->filled |= BIT_ULL(NL80211_STA_INFO_TX_BITRATE);
+}
+#endif
+
+static void rtl_op_get_et_strings(struct ieee80211_hw *hw,
+				  struct ieee80211_vif *vif,
+				  u32 sset, u8 *data)
+{
+	if (sset == ETH_SS_STATS)
+		memcpy(data, rtl_data_stats_strings,
+		       RTL_DATA_STATS_LEN * ETH_GSTRING_LEN);
+}
+
+static int rtl_op_get_et_sset_count(struct ieee80211_hw *hw,
+				    struct ieee80211_vif *vif, int sset)
+{
+	if (sset == ETH_SS_STATS)
+		return RTL_DATA_STATS_LEN;
+	return 0;
+}
+
+static void rtl_op_get_et_stats(struct ieee80211_hw *hw,
+				struct ieee80211_vif *vif,
+				struct ethtool_stats *stats, u64 *data)
+{
+	rtl_data_stats_read(rtl_priv(hw), (struct rtl_data_stats *)data);
+}
+
 static int rtl_op_ampdu_action(struct ieee80211_hw *hw,
 			       struct ieee80211_vif *vif,
 #if (LINUX_VERSION_CODE >= KERNEL_VERSION(4, 6, 0))
@@ -1485,7 +1928,8 @@ static void rtl_op_sw_scan_complete(struct ieee80211_hw *hw)
 	mac->act_scanning = false;
 	mac->skip_scan = false;
 
-	rtlpriv->btcoexist.btc_info.ap_num = rtlpriv->scan_list.num;
+	rtlpriv->btcoexist.btc_info.ap_num = min_t(u32, rtlpriv->scan_list.num,
+						     U8_MAX);
 
 	if (rtlpriv->link_info.higher_busytraffic)
 		return;
@@ -1544,6 +1988,8 @@ static int rtl_op_set_key(struct ieee80211_hw *hw, enum set_key_cmd cmd,
 	rtlpriv->sec.being_setkey = true;
 	rtl_ips_nic_on(hw);
 	mutex_lock(&rtlpriv->locks.conf_mutex);
+	/* a clear_all or a rekey touches several entries */
+	rtl_cam_batch_begin(hw);
 	/* <1> get encryption alg */
 
 	switch (key->cipher) {
@@ -1696,7 +2142,7 @@ static int rtl_op_set_key(struct ieee80211_hw *hw, enum set_key_cmd cmd,
 		 *so don't use rtl_cam_reset_all_entry
 		 *or clear all entry here.
 		 */
-		rtl_wait_tx_report_acked(hw, 500); /* wait 500ms for TX ack */
+		rtl_wait_tx_report_acked(hw, rtl_key_wait_ms);
 
 		rtl_cam_delete_one_entry(hw, mac_addr, key_idx);
 		break;
@@ -1704,6 +2150,7 @@ static int rtl_op_set_key(struct ieee80211_hw *hw, enum set_key_cmd cmd,
 		pr_err("cmd_err:%x!!!!:\n", cmd);
 	}
 out_unlock:
+	rtl_cam_batch_end(hw);
 	mutex_unlock(&rtlpriv->locks.conf_mutex);
 	rtlpriv->sec.being_setkey = false;
 	return err;
@@ -1766,9 +2213,10 @@ static void rtl_op_flush(struct ieee80211_hw *hw,
  *	Assumption:
  *		We should follow specific format that was released from HW SD.
  */
-bool rtl_hal_pwrseqcmdparsing(struct rtl_priv *rtlpriv, u8 cut_version,
-			      u8 faversion, u8 interface_type,
-			      struct wlan_pwr_cfg pwrcfgcmd[])
+static bool _rtl_hal_pwrseq_interpret(struct rtl_priv *rtlpriv,
+				      u8 cut_version, u8 faversion,
+				      u8 interface_type,
+				      struct wlan_pwr_cfg pwrcfgcmd[])
 {
 	struct wlan_pwr_cfg cfg_cmd = {0};
 	bool polling_bit = false;
@@ -1856,8 +2304,252 @@ bool rtl_hal_pwrseqcmdparsing(struct rtl_priv *rtlpriv, u8 cut_version,
 
 	return true;
 }
+
+static struct rtl_pwrseq_prog *
+_rtl_pwrseq_compile(struct wlan_pwr_cfg flow[], u8 cut, u8 fab, u8 intf)
+{
+	struct rtl_pwrseq_prog *prog;
+	struct rtl_pwrseq_op *op = NULL;
+	u64 start = ktime_get_ns();
+	u16 i, entries;
+	u32 delay_us;
+	u8 lane;
+
+	for (entries = 0; GET_PWR_CFG_CMD(flow[entries]) != PWR_CMD_END;
+	     entries++)
+		;
+
+	/* IPS brings the NIC up under a spinlock */
+	prog = kzalloc(sizeof(*prog) + entries * sizeof(prog->ops[0]),
+		       GFP_ATOMIC);
+	if (!prog)
+		return NULL;
+
+	for (i = 0; i < entries; i++) {
+		struct wlan_pwr_cfg cfg = flow[i];
+
+		if (!(GET_PWR_CFG_FAB_MASK(cfg) & fab) ||
+		    !(GET_PWR_CFG_CUT_MASK(cfg) & cut) ||
+		    !(GET_PWR_CFG_INTF_MASK(cfg) & intf))
+			continue;
+
+		switch (GET_PWR_CFG_CMD(cfg)) {
+		case PWR_CMD_WRITE:
+			lane = GET_PWR_CFG_OFFSET(cfg) & 3;
+			/* a following byte of the same dword joins the step,
+			 * see _rtl_pwrseq_write() for the order of accesses
+			 */
+			if (!op || op->cmd != PWR_CMD_WRITE ||
+			    (op->offset & ~3) != (GET_PWR_CFG_OFFSET(cfg) & ~3) ||
+			    BIT(lane) <= op->lanes) {
+				op = &prog->ops[prog->len++];
+				op->cmd = PWR_CMD_WRITE;
+				op->offset = GET_PWR_CFG_OFFSET(cfg);
+				op->entry = i;
+			}
+			op->lanes |= BIT(lane);
+			op->mask |= (u32)GET_PWR_CFG_MASK(cfg) << (lane * 8);
+			op->value |= (u32)(GET_PWR_CFG_VALUE(cfg) &
+					   GET_PWR_CFG_MASK(cfg)) << (lane * 8);
+			break;
+		case PWR_CMD_POLLING:
+			op = &prog->ops[prog->len++];
+			op->cmd = PWR_CMD_POLLING;
+			op->offset = GET_PWR_CFG_OFFSET(cfg);
+			op->entry = i;
+			op->mask = GET_PWR_CFG_MASK(cfg);
+			op->value = GET_PWR_CFG_VALUE(cfg) & GET_PWR_CFG_MASK(cfg);
+			break;
+		case PWR_CMD_DELAY:
+			delay_us = GET_PWR_CFG_OFFSET(cfg);
+			if (GET_PWR_CFG_VALUE(cfg) != PWRSEQ_DELAY_US)
+				delay_us *= 1000;
+			if (!op || op->cmd != PWR_CMD_DELAY) {
+				op = &prog->ops[prog->len++];
+				op->cmd = PWR_CMD_DELAY;
+				op->entry = i;
+			}
+			op->value += delay_us;
+			break;
+		default:
+			/* PWR_CMD_READ does nothing */
+			break;
+		}
+	}
+
+	prog->flow = flow;
+	prog->cut = cut;
+	prog->fab = fab;
+	prog->intf = intf;
+	prog->entries = entries;
+	prog->compile_ns = ktime_get_ns() - start;
+	return prog;
+}
+
+/* Each byte is read right before it is written, as the interpreter does,
+ * since writing one byte of a power register may change the next one. A
+ * byte written as a whole is not read, its old value would be dropped.
+ */
+static void _rtl_pwrseq_write(struct rtl_priv *rtlpriv,
+			      const struct rtl_pwrseq_op *op)
+{
+	u32 addr = op->offset & ~3;
+	u8 lane, mask, val;
+
+	for (lane = 0; lane < 4; lane++) {
+		if (!(op->lanes & BIT(lane)))
+			continue;
+
+		mask = op->mask >> (lane * 8);
+		val = op->value >> (lane * 8);
+		if (mask != 0xff)
+			val |= rtl_read_byte(rtlpriv, addr + lane) & ~mask;
+		rtl_write_byte(rtlpriv, addr + lane, val);
+	}
+}
+
+static bool _rtl_pwrseq_poll(struct rtl_priv *rtlpriv,
+			     const struct rtl_pwrseq_op *op, bool can_sleep)
+{
+	u64 deadline = ktime_get_ns() + RTL_PWRSEQ_POLL_US * NSEC_PER_USEC;
+	u32 count = 0;
+
+	while ((rtl_read_byte(rtlpriv, op->offset) & op->mask) != op->value) {
+		if (can_sleep) {
+			if (ktime_get_ns() > deadline)
+				return false;
+			usleep_range(10, 20);
+		} else {
+			if (count++ >= RTL_PWRSEQ_POLL_US / 10)
+				return false;
+			udelay(10);
+		}
+	}
+	return true;
+}
+
+static void _rtl_pwrseq_delay(u32 delay_us, bool can_sleep)
+{
+	if (can_sleep && delay_us >= 20000) {
+		msleep(delay_us / 1000);
+	} else if (can_sleep && delay_us >= 10) {
+		usleep_range(delay_us, delay_us + delay_us / 8);
+	} else {
+		if (delay_us >= 1000)
+			mdelay(delay_us / 1000);
+		udelay(delay_us % 1000);
+	}
+}
+
+static bool _rtl_pwrseq_run(struct rtl_priv *rtlpriv,
+			    struct rtl_pwrseq_prog *prog, bool can_sleep)
+{
+	struct rtl_pwrseq_op *op = prog->ops;
+	struct rtl_pwrseq_op *end = op + prog->len;
+	u64 start = ktime_get_ns();
+	u64 last = start, now;
+	bool ret = true;
+
+	for (; op < end && ret; op++) {
+		switch (op->cmd) {
+		case PWR_CMD_WRITE:
+			_rtl_pwrseq_write(rtlpriv, op);
+			break;
+		case PWR_CMD_POLLING:
+			ret = _rtl_pwrseq_poll(rtlpriv, op, can_sleep);
+			break;
+		case PWR_CMD_DELAY:
+			_rtl_pwrseq_delay(op->value, can_sleep);
+			break;
+		}
+
+		now = ktime_get_ns();
+		op->last_ns = now - last;
+		op->max_ns = max(op->max_ns, op->last_ns);
+		op->total_ns += op->last_ns;
+		op->runs++;
+		last = now;
+	}
+
+	if (!ret) {
+		prog->fails++;
+		RT_TRACE(rtlpriv, COMP_INIT, DBG_WARNING,
+			 "power sequence %ps: polling %#x timed out\n",
+			 prog->flow, (op - 1)->offset);
+	}
+	prog->run_ns = last - start;
+	prog->max_ns = max(prog->max_ns, prog->run_ns);
+	prog->runs++;
+	return ret;
+}
+
+static struct rtl_pwrseq_prog *
+_rtl_pwrseq_prog_get(struct rtl_priv *rtlpriv, u8 cut, u8 fab, u8 intf,
+		     struct wlan_pwr_cfg flow[])
+{
+	struct rtl_ps_ctl *ppsc = rtl_psc(rtlpriv);
+	struct rtl_pwrseq_prog *prog;
+	int i;
+
+	for (i = 0; i < RTL_PWRSEQ_PROG_MAX; i++) {
+		prog = ppsc->pwrseq[i];
+		if (!prog)
+			break;
+		if (prog->flow == flow && prog->cut == cut &&
+		    prog->fab == fab && prog->intf == intf)
+			return prog;
+	}
+	if (i == RTL_PWRSEQ_PROG_MAX)
+		return NULL;
+
+	prog = _rtl_pwrseq_compile(flow, cut, fab, intf);
+	if (!prog)
+		return NULL;
+	ppsc->pwrseq[i] = prog;
+	RT_TRACE(rtlpriv, COMP_INIT, DBG_LOUD,
+		 "power sequence %ps: %u entries, %u steps, compiled in %llu ns\n",
+		 flow, prog->entries, prog->len, prog->compile_ns);
+	return prog;
+}
+
+/* Runs a power sequence flow. The first call for a flow filters it by the
+ * cut, fab and interface of the chip into a program, drops the reads of
+ * bytes written as a whole and sums up the delays. Polls and delays
+ * sleep unless IPS holds ips_lock or we are in atomic context.
+ */
+bool rtl_hal_pwrseqcmdparsing(struct rtl_priv *rtlpriv, u8 cut_version,
+			      u8 faversion, u8 interface_type,
+			      struct wlan_pwr_cfg pwrcfgcmd[])
+{
+	struct rtl_pwrseq_prog *prog = NULL;
+	bool can_sleep;
+
+	if (rtl_pwrseq_prog)
+		prog = _rtl_pwrseq_prog_get(rtlpriv, cut_version, faversion,
+					    interface_type, pwrcfgcmd);
+	if (!prog)
+		return _rtl_hal_pwrseq_interpret(rtlpriv, cut_version,
+						 faversion, interface_type,
+						 pwrcfgcmd);
+
+	can_sleep = !rtl_psc(rtlpriv)->pwrseq_atomic && !in_interrupt() &&
+		    !irqs_disabled();
+	return _rtl_pwrseq_run(rtlpriv, prog, can_sleep);
+}
 EXPORT_SYMBOL(rtl_hal_pwrseqcmdparsing);
 
+void rtl_pwrseq_free(struct ieee80211_hw *hw)
+{
+	struct rtl_ps_ctl *ppsc = rtl_psc(rtl_priv(hw));
+	int i;
+
+	for (i = 0; i < RTL_PWRSEQ_PROG_MAX; i++) {
+		kfree(ppsc->pwrseq[i]);
+		ppsc->pwrseq[i] = NULL;
+	}
+}
+EXPORT_SYMBOL_GPL(rtl_pwrseq_free);
+
 bool rtl_cmd_send_packet(struct ieee80211_hw *hw, struct sk_buff *skb)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
@@ -1869,7 +2561,7 @@ bool rtl_cmd_send_packet(struct ieee80211_hw *hw, struct sk_buff *skb)
 
 	ring = &rtlpci->tx_ring[BEACON_QUEUE];
 
-	spin_lock_irqsave(&rtlpriv->locks.irq_th_lock, flags);
+	spin_lock_irqsave(&ring->lock, flags);
 	pskb = __skb_dequeue(&ring->queue);
 	if (pskb)
 		dev_kfree_skb_irq(pskb);
@@ -1881,7 +2573,7 @@ bool rtl_cmd_send_packet(struct ieee80211_hw *hw, struct sk_buff *skb)
 
 	__skb_queue_tail(&ring->queue, skb);
 
-	spin_unlock_irqrestore(&rtlpriv->locks.irq_th_lock, flags);
+	spin_unlock_irqrestore(&ring->lock, flags);
 
 	rtlpriv->cfg->ops->tx_polling(hw, BEACON_QUEUE);
 
@@ -1908,6 +2600,12 @@ const struct ieee80211_ops rtl_ops = {
 	.set_tsf = rtl_op_set_tsf,
 	.reset_tsf = rtl_op_reset_tsf,
 	.sta_notify = rtl_op_sta_notify,
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
+	.sta_statistics = rtl_op_sta_statistics,
+#endif
+	.get_et_strings = rtl_op_get_et_strings,
+	.get_et_sset_count = rtl_op_get_et_sset_count,
+	.get_et_stats = rtl_op_get_et_stats,
 	.ampdu_action = rtl_op_ampdu_action,
 	.sw_scan_start = rtl_op_sw_scan_start,
 	.sw_scan_complete = rtl_op_sw_scan_complete,
@@ -79,6 +79,21 @@ void rtl_addr_delay(u32 addr);
 void rtl_rfreg_delay(struct ieee80211_hw *hw, enum radio_path rfpath, u32 addr,
 		     u32 mask, u32 data);
 void rtl_bb_delay(struct ieee80211_hw *hw, u32 addr, u32 data);
+bool rtl_phy_prog_load(struct ieee80211_hw *hw, enum rtl_phy_prog_id id,
+		       const u32 *table, u32 len, enum rtl_phy_write type,
+		       enum radio_path rfpath,
+		       bool (*check)(struct ieee80211_hw *hw,
+				     u32 cond1, u32 cond2));
+void rtl_phy_prog_free(struct ieee80211_hw *hw);
+struct rtl_cal_entry *rtl_cal_cache_get(struct ieee80211_hw *hw);
+void rtl_cal_cache_put(struct ieee80211_hw *hw, const u32 *val, u8 num,
+		       u64 cal_ns);
+bool rtl_iqk_cache_reload(struct ieee80211_hw *hw, const u32 *iqk_rx_reg,
+			  u8 num, long *result);
+void rtl_iqk_cache_save(struct ieee80211_hw *hw, const u32 *iqk_rx_reg,
+			u8 num, const long *result, u64 start);
+void rtl_cal_cache_free(struct ieee80211_hw *hw);
+void rtl_pwrseq_free(struct ieee80211_hw *hw);
 bool rtl_cmd_send_packet(struct ieee80211_hw *hw, struct sk_buff *skb);
 bool rtl_btc_status_false(void);
 void rtl_dm_diginit(struct ieee80211_hw *hw, u32 cur_igval);
@@ -23,7 +23,11 @@
  *****************************************************************************/
 
 #include "wifi.h"
+#include "base.h"
 #include "cam.h"
+#include "pci.h"
+#include "usb.h"
+#include "rc.h"
 
 #include <linux/moduleparam.h>
 
@@ -661,45 +665,37 @@ static const struct file_operations file_ops_rf_b = {
 	.release = seq_release,
 };
 
+/* The CAM is dumped from the driver's shadow (see cam.c), so reading it
+ * doesn't disturb key programming. Entries marked '?' have not been
+ * fully written since the last reset; their shadow may not match.
+ */
+static void _rtl_debug_print_cam(struct seq_file *m, struct rtl_priv *rtlpriv,
+				 int first, int last)
+{
+	struct rtl_security *sec = &rtlpriv->sec;
+	u8 entry_i = 0;
+	int j;
+
+	for (j = first; j < last; j++) {
+		seq_printf(m, "\nD: %c%2x > ",
+			   sec->cam_synced & BIT(j) ? ' ' : '?', j);
+		for (entry_i = 0; entry_i < CAM_CONTENT_COUNT; entry_i++)
+			seq_printf(m, "%8.8x ", sec->cam_shadow[j][entry_i]);
+	}
+	seq_puts(m, "\n");
+}
+
 static int rtl_debug_get_cam_register_1(struct seq_file *m, void *v)
 {
 	struct ieee80211_hw *hw = m->private;
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
-	u32 target_cmd = 0;
-	u32 target_val = 0;
-	u8 entry_i = 0;
-	u32 ulstatus;
-	int i = 100, j = 0;
 
+	seq_printf(m, "CAM writes %llu, skipped %llu\n",
+		   rtlpriv->sec.cam_writes, rtlpriv->sec.cam_skipped);
 	/* This dump the current register page */
 	seq_puts(m,
 		 "\n#################### SECURITY CAM (0-10) ##################\n ");
-
-	for (j = 0; j < 11; j++) {
-		seq_printf(m, "\nD:  %2x > ", j);
-		for (entry_i = 0; entry_i < CAM_CONTENT_COUNT; entry_i++) {
-			/* polling bit, and No Write enable, and address  */
-			target_cmd = entry_i + CAM_CONTENT_COUNT * j;
-			target_cmd = target_cmd | BIT(31);
-
-			/* Check polling bit is clear */
-			while ((i--) >= 0) {
-				ulstatus = rtl_read_dword(rtlpriv,
-						rtlpriv->cfg->maps[RWCAM]);
-				if (ulstatus & BIT(31))
-					continue;
-				else
-					break;
-			}
-
-			rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[RWCAM],
-					target_cmd);
-			target_val = rtl_read_dword(rtlpriv,
-						    rtlpriv->cfg->maps[RCAMO]);
-			seq_printf(m, "%8.8x ", target_val);
-		}
-	}
-	seq_puts(m, "\n");
+	_rtl_debug_print_cam(m, rtlpriv, 0, 11);
 	return 0;
 }
 
@@ -720,39 +716,11 @@ static int rtl_debug_get_cam_register_2(struct seq_file *m, void *v)
 {
 	struct ieee80211_hw *hw = m->private;
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
-	u32 target_cmd = 0;
-	u32 target_val = 0;
-	u8 entry_i = 0;
-	u32 ulstatus;
-	int i = 100, j = 0;
 
 	/* This dump the current register page */
 	seq_puts(m,
 		 "\n################### SECURITY CAM (11-21) ##################\n ");
-
-	for (j = 11; j < 22; j++) {
-		seq_printf(m, "\nD:  %2x > ", j);
-		for (entry_i = 0; entry_i < CAM_CONTENT_COUNT; entry_i++) {
-			target_cmd = entry_i + CAM_CONTENT_COUNT * j;
-			target_cmd = target_cmd | BIT(31);
-
-			while ((i--) >= 0) {
-				ulstatus = rtl_read_dword(rtlpriv,
-						rtlpriv->cfg->maps[RWCAM]);
-				if (ulstatus & BIT(31))
-					continue;
-				else
-					break;
-			}
-
-			rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[RWCAM],
-					target_cmd);
-			target_val = rtl_read_dword(rtlpriv,
-						    rtlpriv->cfg->maps[RCAMO]);
-			seq_printf(m, "%8.8x ", target_val);
-		}
-	}
-	seq_puts(m, "\n");
+	_rtl_debug_print_cam(m, rtlpriv, 11, 22);
 	return 0;
 }
 
@@ -773,39 +741,11 @@ static int rtl_debug_get_cam_register_3(struct seq_file *m, void *v)
 {
 	struct ieee80211_hw *hw = m->private;
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
-	u32 target_cmd = 0;
-	u32 target_val = 0;
-	u8 entry_i = 0;
-	u32 ulstatus;
-	int i = 100, j = 0;
 
 	/* This dump the current register page */
 	seq_puts(m,
 		 "\n################### SECURITY CAM (22-31) ##################\n ");
-
-	for (j = 22; j < TOTAL_CAM_ENTRY; j++) {
-		seq_printf(m, "\nD:  %2x > ", j);
-		for (entry_i = 0; entry_i < CAM_CONTENT_COUNT; entry_i++) {
-			target_cmd = entry_i + CAM_CONTENT_COUNT * j;
-			target_cmd = target_cmd | BIT(31);
-
-			while ((i--) >= 0) {
-				ulstatus = rtl_read_dword(rtlpriv,
-						rtlpriv->cfg->maps[RWCAM]);
-				if (ulstatus & BIT(31))
-					continue;
-				else
-					break;
-			}
-
-			rtl_write_dword(rtlpriv, rtlpriv->cfg->maps[RWCAM],
-					target_cmd);
-			target_val = rtl_read_dword(rtlpriv,
-						    rtlpriv->cfg->maps[RCAMO]);
-			seq_printf(m, "%8.8x ", target_val);
-		}
-	}
-	seq_puts(m, "\n");
+	_rtl_debug_print_cam(m, rtlpriv, 22, TOTAL_CAM_ENTRY);
 	return 0;
 }
 
@@ -861,6 +801,756 @@ static const struct file_operations file_ops_btcoex = {
 	.release = seq_release,
 };
 
+static int rtl_debug_get_napi(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_pci *rtlpci;
+	struct rtl_pci_napi_stats *stats;
+
+	if (rtlpriv->rtlhal.interface != INTF_PCI) {
+		seq_puts(m, "NAPI is only used on PCI devices\n");
+		return 0;
+	}
+
+	rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+	stats = &rtlpci->napi_stats;
+
+	seq_printf(m, "napi: %s\n", rtlpci->napi_enabled ? "on" : "off");
+	seq_printf(m, "polls: %llu\n", stats->polls);
+	seq_printf(m, "budget exhausted: %llu\n", stats->budget_exhausted);
+	seq_printf(m, "rx frames: %llu\n", stats->rx_frames);
+	seq_printf(m, "interrupts: %llu\n", stats->interrupts);
+	seq_printf(m, "interrupts/s: %u\n", stats->irq_per_sec);
+	return 0;
+}
+
+static int dl_debug_open_napi(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_napi, inode->i_private);
+}
+
+static const struct file_operations file_ops_napi = {
+	.open = dl_debug_open_napi,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static int rtl_debug_get_tx_report(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_tx_report *tx_report = &rtlpriv->tx_report;
+	int i;
+
+	seq_printf(m, "firmware TX report: %s\n",
+		   rtlpriv->cfg->tx_status_report ? "supported" :
+		   "not supported");
+	seq_printf(m, "pending: %u\n", skb_queue_len(&tx_report->queue));
+	seq_printf(m, "acked: %llu\n", tx_report->acked);
+	seq_printf(m, "failed: %llu\n", tx_report->failed);
+	seq_printf(m, "retries: %llu\n", tx_report->retries);
+	seq_printf(m, "timeout: %llu\n", tx_report->timeout);
+	seq_printf(m, "unmatched: %llu\n", tx_report->unmatched);
+	seq_printf(m, "last sent sn: 0x%X, last received sn: 0x%X\n",
+		   tx_report->last_sent_sn, tx_report->last_recv_sn);
+	seq_printf(m, "last EAPOL sn: 0x%X, %s\n", tx_report->eapol_sn,
+		   tx_report->eapol_pending ? "pending" : "reported");
+
+	seq_printf(m, "key removal waits: %llu, timed out: %llu\n",
+		   tx_report->waits, tx_report->wait_timeouts);
+	for (i = 0; i < RTL_TX_REPORT_WAIT_HIST; i++) {
+		if (i == 0)
+			seq_puts(m, "     <1 ms:");
+		else if (i == RTL_TX_REPORT_WAIT_HIST - 1)
+			seq_printf(m, "  >=%3d ms:", 1 << (i - 1));
+		else
+			seq_printf(m, "%3d-%3d ms:", 1 << (i - 1), (1 << i) - 1);
+		seq_printf(m, " %u\n", tx_report->wait_hist[i]);
+	}
+	return 0;
+}
+
+static int dl_debug_open_tx_report(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_tx_report, inode->i_private);
+}
+
+static const struct file_operations file_ops_tx_report = {
+	.open = dl_debug_open_tx_report,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static int rtl_debug_get_rx_copy(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_pci *rtlpci;
+
+	if (rtlpriv->rtlhal.interface != INTF_PCI) {
+		seq_puts(m, "RX copy is only used on PCI devices\n");
+		return 0;
+	}
+
+	rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+
+	seq_printf(m, "copied frames: %llu\n", rtlpci->rx_copied);
+	seq_printf(m, "copy failures: %llu\n", rtlpci->rx_copy_fails);
+	return 0;
+}
+
+static int dl_debug_open_rx_copy(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_rx_copy, inode->i_private);
+}
+
+static const struct file_operations file_ops_rx_copy = {
+	.open = dl_debug_open_rx_copy,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static int rtl_debug_get_tx_batch(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_pci *rtlpci;
+	struct rtl_pci_tx_batch_stats *stats;
+	int i;
+
+	if (rtlpriv->rtlhal.interface != INTF_PCI) {
+		seq_puts(m, "TX batching is only used on PCI devices\n");
+		return 0;
+	}
+
+	rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+
+	seq_printf(m, "batch limit: %d\n", rtlpci->tx_batch);
+	seq_puts(m, "queue     frames  doorbells    flushes  largest   reclaims  reclaimed\n");
+	for (i = 0; i < RTL_PCI_MAX_TX_QUEUE_COUNT; i++) {
+		stats = &rtlpci->tx_ring[i].batch_stats;
+		if (!stats->frames)
+			continue;
+
+		seq_printf(m, "%5d %10llu %10llu %10llu %8u %10llu %10llu\n",
+			   i, stats->frames, stats->doorbells, stats->flushes,
+			   stats->max_batch, stats->reclaims,
+			   stats->reclaimed);
+	}
+	return 0;
+}
+
+static int dl_debug_open_tx_batch(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_tx_batch, inode->i_private);
+}
+
+static const struct file_operations file_ops_tx_batch = {
+	.open = dl_debug_open_tx_batch,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static int rtl_debug_get_irq_mod(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_pci *rtlpci;
+	struct rtl_pci_irq_mod *mod;
+	int i;
+
+	if (rtlpriv->rtlhal.interface != INTF_PCI) {
+		seq_puts(m, "interrupt moderation is only used on PCI devices\n");
+		return 0;
+	}
+
+	rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+	mod = &rtlpci->irq_mod;
+
+	seq_printf(m, "threaded irq: %s\n", rtlpci->irq_threaded ? "on" : "off");
+	seq_printf(m, "moderation: %s (%s)\n", mod->active ? "on" : "off",
+		   rtlpriv->cfg->hw_int_migration ? "hw migration" :
+		   "sw hold-off");
+	seq_printf(m, "frames/s: %u\n", mod->frames_per_sec);
+	seq_printf(m, "irq/s: %u\n", rtlpci->napi_stats.irq_per_sec);
+	seq_printf(m, "hold-offs: %llu\n", mod->holdoffs);
+	seq_printf(m, "switches: %llu\n", mod->switches);
+
+	/* buckets are labelled with their lower bound */
+	seq_puts(m, "irq/s     seconds\n");
+	for (i = 0; i < RTL_PCI_IRQ_HIST_SIZE; i++)
+		seq_printf(m, ">=%-6u %llu\n", i ? 1000 << (i - 1) : 0,
+			   mod->rate_hist[i]);
+
+	seq_puts(m, "frames/irq  interrupts\n");
+	for (i = 0; i < RTL_PCI_IRQ_HIST_SIZE; i++)
+		seq_printf(m, ">=%-8u %llu\n", i ? 1 << (i - 1) : 0,
+			   mod->frames_hist[i]);
+	return 0;
+}
+
+static int dl_debug_open_irq_mod(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_irq_mod, inode->i_private);
+}
+
+static const struct file_operations file_ops_irq_mod = {
+	.open = dl_debug_open_irq_mod,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static int rtl_debug_get_usb_tx_agg(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_usb *rtlusb;
+	int ep, i;
+
+	if (rtlpriv->rtlhal.interface != INTF_USB) {
+		seq_puts(m, "TX aggregation is only used on USB devices\n");
+		return 0;
+	}
+
+	rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+
+	seq_printf(m, "max frames: %d\n", rtlusb->tx_agg_num);
+	seq_printf(m, "max bytes: %d\n", rtlusb->tx_agg_size);
+	seq_printf(m, "timeouts: %llu\n", rtlusb->tx_agg_timeouts);
+	seq_printf(m, "buffer misses: %llu\n", rtlusb->tx_agg_buf_misses);
+	seq_puts(m, "bulk-OUT transfers per frames carried\n");
+	for (ep = 0; ep < RTL_USB_MAX_EP_NUM; ep++) {
+		for (i = 1; i <= RTL_USB_TX_AGG_MAX_NUM; i++)
+			if (rtlusb->tx_agg_hist[ep][i])
+				break;
+		if (i > RTL_USB_TX_AGG_MAX_NUM)
+			continue;
+
+		seq_printf(m, "ep%d:", ep);
+		for (i = 1; i <= rtlusb->tx_agg_num; i++)
+			seq_printf(m, " %d:%llu", i, rtlusb->tx_agg_hist[ep][i]);
+		seq_puts(m, "\n");
+	}
+	return 0;
+}
+
+static int dl_debug_open_usb_tx_agg(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_usb_tx_agg, inode->i_private);
+}
+
+static const struct file_operations file_ops_usb_tx_agg = {
+	.open = dl_debug_open_usb_tx_agg,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static int rtl_debug_get_usb_rx_agg(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_usb *rtlusb;
+	int i;
+
+	if (rtlpriv->rtlhal.interface != INTF_USB) {
+		seq_puts(m, "RX aggregation is only used on USB devices\n");
+		return 0;
+	}
+
+	rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+	if (!rtlusb->usb_rx_segregate_hdl) {
+		seq_puts(m, "RX aggregation is not supported\n");
+		return 0;
+	}
+
+	seq_printf(m, "threshold: %d pages\n",
+		   rtlpriv->cfg->mod_params->usb_rx_agg);
+	seq_printf(m, "transfers: %llu\n", rtlusb->rx_agg_urbs);
+	seq_printf(m, "frames: %llu\n", rtlusb->rx_agg_frames);
+	seq_puts(m, "bulk-IN transfers per frames carried\n");
+	for (i = 0; i < RTL_USB_RX_AGG_HIST_SIZE; i++) {
+		if (!rtlusb->rx_agg_hist[i])
+			continue;
+		seq_printf(m, "%3d%s %llu\n", i,
+			   i == RTL_USB_RX_AGG_HIST_SIZE - 1 ? "+" : " ",
+			   rtlusb->rx_agg_hist[i]);
+	}
+	return 0;
+}
+
+static int dl_debug_open_usb_rx_agg(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_usb_rx_agg, inode->i_private);
+}
+
+static const struct file_operations file_ops_usb_rx_agg = {
+	.open = dl_debug_open_usb_rx_agg,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static void rtl_debug_usb_pool(struct seq_file *m, const char *name,
+			       struct rtl_usb_urb_pool *pool)
+{
+	unsigned long flags;
+
+	if (!pool->urbs)
+		return;
+
+	spin_lock_irqsave(&pool->lock, flags);
+	seq_printf(m, "%-6s %4u %4u %8u %12llu %8llu %6llu\n", name,
+		   pool->size, pool->free, pool->min_free, pool->gets,
+		   pool->misses, pool->stalls);
+	spin_unlock_irqrestore(&pool->lock, flags);
+}
+
+static int rtl_debug_get_usb_pools(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_usb *rtlusb;
+
+	if (rtlpriv->rtlhal.interface != INTF_USB) {
+		seq_puts(m, "URB pools are only used on USB devices\n");
+		return 0;
+	}
+
+	rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+	seq_puts(m, "pool   size free min_free         gets   misses stalls\n");
+	rtl_debug_usb_pool(m, "tx", &rtlusb->tx_urb_pool);
+	rtl_debug_usb_pool(m, "ctrl", &rtlusb->ctrl_urb_pool);
+	seq_printf(m, "rx     %4u\n", rtlusb->rx_urb_num);
+	return 0;
+}
+
+static int dl_debug_open_usb_pools(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_usb_pools, inode->i_private);
+}
+
+static const struct file_operations file_ops_usb_pools = {
+	.open = dl_debug_open_usb_pools,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static int rtl_debug_get_usb_io(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_usb *rtlusb;
+
+	if (rtlpriv->rtlhal.interface != INTF_USB) {
+		seq_puts(m, "Register access counters are only kept on USB devices\n");
+		return 0;
+	}
+
+	rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+	seq_printf(m, "register writes: %llu\n", rtlusb->io_reg_writes);
+	seq_printf(m, "write transfers: %llu\n", rtlusb->io_ctrl_writes);
+	seq_printf(m, "read transfers: %llu\n", rtlusb->io_ctrl_reads);
+	seq_printf(m, "last hw_init: %llu register writes, %llu transfers\n",
+		   rtlusb->io_init_reg_writes, rtlusb->io_init_xfers);
+	return 0;
+}
+
+static int dl_debug_open_usb_io(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_usb_io, inode->i_private);
+}
+
+static const struct file_operations file_ops_usb_io = {
+	.open = dl_debug_open_usb_io,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static int rtl_debug_get_usb_tx_flow(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_usb *rtlusb;
+	int i;
+
+	if (rtlpriv->rtlhal.interface != INTF_USB) {
+		seq_puts(m, "TX flow control is only used on USB devices\n");
+		return 0;
+	}
+
+	rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+	seq_printf(m, "limits: %d urbs, %d bytes per endpoint\n",
+		   RTL_USB_MAX_TX_URBS_NUM, RTL_USB_MAX_TX_BYTES);
+	seq_printf(m, "stopped queues: BK %d BE %d VI %d VO %d\n",
+		   test_bit(RTL_TXQ_BK, &rtlusb->tx_queues_stopped),
+		   test_bit(RTL_TXQ_BE, &rtlusb->tx_queues_stopped),
+		   test_bit(RTL_TXQ_VI, &rtlusb->tx_queues_stopped),
+		   test_bit(RTL_TXQ_VO, &rtlusb->tx_queues_stopped));
+	seq_puts(m, "ep urbs    bytes stopped    stops\n");
+	for (i = 0; i < RTL_USB_MAX_EP_NUM; i++) {
+		if (!atomic_read(&rtlusb->tx_inflight[i]) &&
+		    !rtlusb->tx_ep_stops[i])
+			continue;
+		seq_printf(m, "%2d %4d %8d %7d %8llu\n", i,
+			   atomic_read(&rtlusb->tx_inflight[i]),
+			   atomic_read(&rtlusb->tx_inflight_bytes[i]),
+			   test_bit(i, &rtlusb->tx_ep_stopped),
+			   rtlusb->tx_ep_stops[i]);
+	}
+	return 0;
+}
+
+static int dl_debug_open_usb_tx_flow(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_usb_tx_flow, inode->i_private);
+}
+
+static const struct file_operations file_ops_usb_tx_flow = {
+	.open = dl_debug_open_usb_tx_flow,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static int rtl_debug_get_rate_control(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_rc *rc = &rtlpriv->rc;
+	struct rtl_rate_priv *rate_priv;
+	unsigned long flags;
+	int i;
+
+	seq_printf(m, "fixed rate: %#x, max rate: %#x\n",
+		   rc->fixed_rate, rc->max_rate);
+	seq_puts(m, "macid rate sgi  reports  changes  per bitrate    tput   frames    acked attempts\n");
+
+	spin_lock_irqsave(&rc->lock, flags);
+	for (i = 0; i < RTL_RC_MACID_NUM; i++) {
+		rate_priv = rc->sta[i];
+		if (!rate_priv)
+			continue;
+		seq_printf(m, "%5d %#4x %3d %8llu %8llu %4u %7u %7u %8llu %8llu %8llu\n",
+			   i, rate_priv->ra_rate, rate_priv->ra_sgi,
+			   rate_priv->ra_reports, rate_priv->ra_changes,
+			   rate_priv->per, rate_priv->cur_bitrate,
+			   rate_priv->tput, rate_priv->tx_frames,
+			   rate_priv->tx_acked, rate_priv->tx_attempts);
+	}
+	spin_unlock_irqrestore(&rc->lock, flags);
+	return 0;
+}
+
+/* "fixed <rate>" pins unicast data to a DESC_RATE* code, "max <rate>"
+ * caps the start rate, "auto" hands both back to the firmware
+ */
+static ssize_t rtl_debugfs_set_rate_control(struct file *filp,
+					    const char __user *buffer,
+					    size_t count, loff_t *loff)
+{
+	struct ieee80211_hw *hw =
+		((struct seq_file *)filp->private_data)->private;
+	struct rtl_rc *rc = &rtl_priv(hw)->rc;
+	char tmp[32] = {};
+	u32 rate;
+
+	if (copy_from_user(tmp, buffer, min_t(size_t, count, sizeof(tmp) - 1)))
+		return -EFAULT;
+
+	if (sscanf(tmp, "fixed %x", &rate) == 1 && rate <= DESC_RATEVHT2SS_MCS9) {
+		WRITE_ONCE(rc->max_rate, -1);
+		WRITE_ONCE(rc->fixed_rate, rate);
+	} else if (sscanf(tmp, "max %x", &rate) == 1 &&
+		   rate <= DESC_RATEVHT2SS_MCS9) {
+		WRITE_ONCE(rc->fixed_rate, -1);
+		WRITE_ONCE(rc->max_rate, rate);
+	} else if (!strncmp(tmp, "auto", 4)) {
+		WRITE_ONCE(rc->fixed_rate, -1);
+		WRITE_ONCE(rc->max_rate, -1);
+	} else {
+		return -EINVAL;
+	}
+	return count;
+}
+
+static int dl_debug_open_rate_control(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_rate_control, inode->i_private);
+}
+
+static const struct file_operations file_ops_rate_control = {
+	.open = dl_debug_open_rate_control,
+	.read = seq_read,
+	.write = rtl_debugfs_set_rate_control,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static int rtl_debug_get_c2hcmd(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_c2hcmd_ring *ring = &rtlpriv->c2hcmd_ring;
+	u32 head = READ_ONCE(ring->head);
+	u32 tail = READ_ONCE(ring->tail);
+
+	seq_printf(m, "ring: %d slots of %d bytes, %u queued\n",
+		   RTL_C2HCMD_RING_SIZE, RTL_C2HCMD_MAX_LEN, head - tail);
+	seq_printf(m, "enqueued %llu processed %llu\n",
+		   ring->enqueued, ring->processed);
+	seq_printf(m, "dropped: full %llu too long %llu\n",
+		   ring->overflows, ring->oversized);
+	seq_printf(m, "max depth %u max batch %u\n",
+		   ring->max_depth, ring->max_batch);
+	return 0;
+}
+
+static int dl_debug_open_c2hcmd(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_c2hcmd, inode->i_private);
+}
+
+static const struct file_operations file_ops_c2hcmd = {
+	.open = dl_debug_open_c2hcmd,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static int rtl_debug_get_rx_mgmt(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	u64 parsed = rtlpriv->stats.rx_bcn_parsed;
+	u64 ns = rtlpriv->stats.rx_bcn_ns;
+
+	seq_printf(m, "beacons %llu ns %llu ns/beacon %llu\n", parsed, ns,
+		   parsed ? div64_u64(ns, parsed) : 0);
+	return 0;
+}
+
+static int dl_debug_open_rx_mgmt(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_rx_mgmt, inode->i_private);
+}
+
+static const struct file_operations file_ops_rx_mgmt = {
+	.open = dl_debug_open_rx_mgmt,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static int rtl_debug_get_ps_gov(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rt_link_detect *link = &rtlpriv->link_info;
+	struct rtl_ps_gov *gov = &rtlpriv->psc.gov;
+	static const char * const ac_name[IEEE80211_NUM_ACS] = {
+		"VO", "VI", "BE", "BK"
+	};
+	int i;
+
+	seq_printf(m, "lps %d for %u ms fw_current_inpsmode %d\n", gov->lps,
+		   jiffies_to_msecs(jiffies - gov->since),
+		   rtlpriv->psc.fw_current_inpsmode);
+	seq_printf(m, "leave_pps %u wake_pkts %u\n", gov->leave_pps,
+		   gov->wake_pkts);
+	seq_printf(m, "enters %llu leaves %llu burst_leaves %llu\n",
+		   gov->enters, gov->leaves, gov->burst_leaves);
+	seq_printf(m, "tx_pps %u rx_pps %u busy %d rx_busy %d higher %d higher_rx %d\n",
+		   link->tx_pps, link->rx_pps, link->busytraffic,
+		   link->rx_busy_traffic, link->higher_busytraffic,
+		   link->higher_busyrxtraffic);
+	for (i = 0; i < IEEE80211_NUM_ACS; i++)
+		seq_printf(m, "%s tx %u pps %u B/s rx %u pps %u B/s\n",
+			   ac_name[i],
+			   link->ac[i].tx_pps >> RTL_TRAFFIC_EWMA_SHIFT,
+			   link->ac[i].tx_byte_rate >> RTL_TRAFFIC_EWMA_SHIFT,
+			   link->ac[i].rx_pps >> RTL_TRAFFIC_EWMA_SHIFT,
+			   link->ac[i].rx_byte_rate >> RTL_TRAFFIC_EWMA_SHIFT);
+	return 0;
+}
+
+static int dl_debug_open_ps_gov(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_ps_gov, inode->i_private);
+}
+
+static const struct file_operations file_ops_ps_gov = {
+	.open = dl_debug_open_ps_gov,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static int rtl_debug_get_data_stats(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_data_stats sum;
+	const u64 *val = (const u64 *)&sum;
+	int i;
+
+	rtl_data_stats_read(rtlpriv, &sum);
+	for (i = 0; i < RTL_DATA_STATS_LEN; i++)
+		seq_printf(m, "%s %llu\n", rtl_data_stats_strings[i], val[i]);
+	return 0;
+}
+
+static int dl_debug_open_data_stats(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_data_stats, inode->i_private);
+}
+
+static const struct file_operations file_ops_data_stats = {
+	.open = dl_debug_open_data_stats,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static int rtl_debug_get_phy_prog(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	static const char * const name[RTL_PHY_PROG_MAX] = {
+		"mac", "phy_reg", "agc_tab", "radio_a", "radio_b"
+	};
+	int i;
+
+	for (i = 0; i < RTL_PHY_PROG_MAX; i++) {
+		struct rtl_phy_prog *prog = rtlpriv->phy.prog[i];
+
+		if (!prog)
+			continue;
+		seq_printf(m, "%-8s entries %4u writes %4u compile %llu ns run %llu ns runs %u\n",
+			   name[i], prog->entries, prog->len,
+			   prog->compile_ns, prog->run_ns, prog->runs);
+	}
+	return 0;
+}
+
+static int dl_debug_open_phy_prog(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_phy_prog, inode->i_private);
+}
+
+static const struct file_operations file_ops_phy_prog = {
+	.open = dl_debug_open_phy_prog,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static int rtl_debug_get_txpwr_cache(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_txpwr_stats *stats = &rtlpriv->phy.txpwr_stats;
+
+	seq_printf(m, "hits %u hit_ns %llu misses %u miss_ns %llu writes %u skips %u bypasses %u bypass_ns %llu\n",
+		   stats->hits, stats->hit_ns, stats->misses, stats->miss_ns,
+		   stats->writes, stats->skips, stats->bypasses,
+		   stats->bypass_ns);
+	return 0;
+}
+
+static int dl_debug_open_txpwr_cache(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_txpwr_cache, inode->i_private);
+}
+
+static const struct file_operations file_ops_txpwr_cache = {
+	.open = dl_debug_open_txpwr_cache,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static int rtl_debug_get_cal_cache(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_cal_stats *stats = &rtlpriv->phy.cal_stats;
+	struct rtl_cal_entry *cache = rtlpriv->phy.cal_cache;
+	int i, valid = 0;
+
+	if (cache)
+		for (i = 0; i < RTL_CAL_CACHE_LEN; i++)
+			valid += cache[i].valid;
+
+	seq_printf(m, "hits %u misses %u expired %u cals %u cal_ns %llu saved_ns %llu entries %d\n",
+		   stats->hits, stats->misses, stats->expired, stats->cals,
+		   stats->cal_ns, stats->saved_ns, valid);
+	return 0;
+}
+
+static int dl_debug_open_cal_cache(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_cal_cache, inode->i_private);
+}
+
+static const struct file_operations file_ops_cal_cache = {
+	.open = dl_debug_open_cal_cache,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
+static int rtl_debug_get_pwrseq(struct seq_file *m, void *v)
+{
+	struct ieee80211_hw *hw = m->private;
+	struct rtl_ps_ctl *ppsc = rtl_psc(rtl_priv(hw));
+	static const char * const cmd[] = {
+		"read", "write", "poll", "delay", "end"
+	};
+	int i, j;
+
+	for (i = 0; i < RTL_PWRSEQ_PROG_MAX; i++) {
+		struct rtl_pwrseq_prog *prog = ppsc->pwrseq[i];
+
+		if (!prog)
+			break;
+		seq_printf(m, "%ps cut %#x fab %#x intf %#x entries %u steps %u compile %llu ns runs %u fails %u last %llu ns max %llu ns\n",
+			   prog->flow, prog->cut, prog->fab, prog->intf,
+			   prog->entries, prog->len, prog->compile_ns,
+			   prog->runs, prog->fails, prog->run_ns,
+			   prog->max_ns);
+		for (j = 0; j < prog->len; j++) {
+			struct rtl_pwrseq_op *op = &prog->ops[j];
+
+			seq_printf(m, "  %3u %-5s %#06x lanes %#x mask %#010x value %#010x runs %u last %u ns max %u ns total %llu ns\n",
+				   op->entry, cmd[op->cmd], op->offset,
+				   op->lanes, op->mask, op->value, op->runs,
+				   op->last_ns, op->max_ns, op->total_ns);
+		}
+	}
+	return 0;
+}
+
+static int dl_debug_open_pwrseq(struct inode *inode, struct file *file)
+{
+	return single_open(file, rtl_debug_get_pwrseq, inode->i_private);
+}
+
+static const struct file_operations file_ops_pwrseq = {
+	.open = dl_debug_open_pwrseq,
+	.read = seq_read,
+	.llseek = seq_lseek,
+	.release = seq_release,
+};
+
 static ssize_t rtl_debugfs_set_write_reg(struct file *filp,
 					 const char __user *buffer,
 					 size_t count, loff_t *loff)
@@ -1115,6 +1805,158 @@ void rtl_debug_add_one(struct ieee80211_hw *hw)
 			 "Unable to initialize debugfs:/%s/%s/btcoex\n",
 			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
 
+	entry1 = debugfs_create_file("napi", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_napi);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/napi\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("tx_report", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_tx_report);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/tx_report\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("rx_copy", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_rx_copy);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/rx_copy\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("tx_batch", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_tx_batch);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/tx_batch\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("irq_mod", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_irq_mod);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/irq_mod\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("usb_tx_agg", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_usb_tx_agg);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/usb_tx_agg\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("usb_rx_agg", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_usb_rx_agg);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/usb_rx_agg\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("usb_pools", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_usb_pools);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/usb_pools\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("usb_io", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_usb_io);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/usb_io\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("usb_tx_flow", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_usb_tx_flow);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/usb_tx_flow\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("rate_control", S_IFREG | 0600,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_rate_control);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/rate_control\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("c2hcmd", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_c2hcmd);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/c2hcmd\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("rx_mgmt", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_rx_mgmt);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/rx_mgmt\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("ps_gov", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_ps_gov);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/ps_gov\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("data_stats", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_data_stats);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/data_stats\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("phy_prog", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_phy_prog);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/phy_prog\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("txpwr_cache", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_txpwr_cache);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/txpwr_cache\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("cal_cache", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_cal_cache);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/cal_cache\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
+	entry1 = debugfs_create_file("pwrseq", S_IFREG | 0400,
+				     rtlpriv->dbg.debugfs_dir, hw,
+				     &file_ops_pwrseq);
+	if (!entry1)
+		RT_TRACE(rtlpriv, COMP_INIT, COMP_ERR,
+			 "Unable to initialize debugfs:/%s/%s/pwrseq\n",
+			 rtlpriv->cfg->name, rtlpriv->dbg.debugfs_name);
+
 	entry1 = debugfs_create_file("write_reg", S_IFREG | 0200,
 				     rtlpriv->dbg.debugfs_dir, hw,
 				     &file_ops_write_reg);
@@ -44,6 +44,34 @@ MODULE_AUTHOR("Larry Finger	<Larry.FInger@lwfinger.net>");
 MODULE_LICENSE("GPL");
 MODULE_DESCRIPTION("PCI basic driver for rtlwifi");
 
+static bool rtl_pci_napi = true;
+module_param_named(napi, rtl_pci_napi, bool, 0444);
+MODULE_PARM_DESC(napi, "Set to 0 to handle RX/TX completion in the hard IRQ (default 1)\n");
+
+static int rtl_pci_tx_batch = 8;
+module_param_named(txbatch, rtl_pci_tx_batch, int, 0444);
+MODULE_PARM_DESC(txbatch, "Max data frames queued per TX doorbell, 1 to ring it for every frame (default 8)\n");
+
+static bool rtl_pci_threaded_irq;
+module_param_named(threaded_irq, rtl_pci_threaded_irq, bool, 0444);
+MODULE_PARM_DESC(threaded_irq, "Set to 1 to service interrupts from an IRQ thread (default 0)\n");
+
+static int rtl_pci_irq_mod = 1;
+module_param_named(irq_mod, rtl_pci_irq_mod, int, 0644);
+MODULE_PARM_DESC(irq_mod, "Interrupt moderation: 0 off, 1 adaptive, 2 always (default 1)\n");
+
+static uint rtl_pci_irq_mod_high = 20000;
+module_param_named(irq_mod_high, rtl_pci_irq_mod_high, uint, 0644);
+MODULE_PARM_DESC(irq_mod_high, "Frames per second that turn adaptive moderation on (default 20000)\n");
+
+static uint rtl_pci_irq_mod_low = 5000;
+module_param_named(irq_mod_low, rtl_pci_irq_mod_low, uint, 0644);
+MODULE_PARM_DESC(irq_mod_low, "Frames per second that turn adaptive moderation off (default 5000)\n");
+
+static uint rtl_pci_irq_holdoff = 100;
+module_param_named(irq_holdoff, rtl_pci_irq_holdoff, uint, 0644);
+MODULE_PARM_DESC(irq_holdoff, "Software interrupt hold-off in usec for chips without interrupt migration (default 100)\n");
+
 #if LINUX_VERSION_CODE < KERNEL_VERSION (3, 17, 0)
 static inline void *
 pci_zalloc_consistent(struct pci_dev *hwdev, size_t size,
@@ -567,34 +595,39 @@ static void _rtl_pci_tx_chk_waitq(struct ieee80211_hw *hw)
 }
 
 
-static void _rtl_pci_tx_isr(struct ieee80211_hw *hw, int prio)
+/* Takes every descriptor the hardware has completed off the ring and
+ * unmaps it. On new trx flow chips get_available_desc() reads the
+ * hardware read pointer once and is_tx_desc_closed() then only compares
+ * against that snapshot. Called with ring->lock held.
+ */
+static u32 _rtl_pci_tx_reclaim(struct ieee80211_hw *hw, int prio,
+			       struct sk_buff_head *done)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
-
 	struct rtl8192_tx_ring *ring = &rtlpci->tx_ring[prio];
+	struct sk_buff *skb;
+	u8 *entry;
+	u32 count = 0;
 
-	while (skb_queue_len(&ring->queue)) {
-		struct sk_buff *skb;
-		struct ieee80211_tx_info *info;
-		__le16 fc;
-		u8 tid;
-		u8 *entry;
+	if (!skb_queue_len(&ring->queue))
+		return 0;
 
+	if (rtlpriv->cfg->ops->get_available_desc &&
+	    rtlpriv->cfg->ops->get_available_desc(hw, prio) <= 1) {
+		RT_TRACE(rtlpriv, (COMP_INTR | COMP_SEND), DBG_DMESG,
+			 "no available desc!\n");
+		return 0;
+	}
+
+	while (skb_queue_len(&ring->queue)) {
 		if (rtlpriv->use_new_trx_flow)
 			entry = (u8 *)(&ring->buffer_desc[ring->idx]);
 		else
 			entry = (u8 *)(&ring->desc[ring->idx]);
 
-		if (rtlpriv->cfg->ops->get_available_desc &&
-		    rtlpriv->cfg->ops->get_available_desc(hw, prio) <= 1) {
-			RT_TRACE(rtlpriv, (COMP_INTR | COMP_SEND), DBG_DMESG,
-				 "no available desc!\n");
-			return;
-		}
-
 		if (!rtlpriv->cfg->ops->is_tx_desc_closed(hw, prio, ring->idx))
-			return;
+			break;
 		ring->idx = (ring->idx + 1) % ring->entries;
 
 		skb = __skb_dequeue(&ring->queue);
@@ -604,22 +637,66 @@ static void _rtl_pci_tx_isr(struct ieee80211_hw *hw, int prio)
 						      HW_DESC_TXBUFF_ADDR),
 				 skb->len, PCI_DMA_TODEVICE);
 
-		/* remove early mode header */
-		if (rtlpriv->rtlhal.earlymode_enable)
-			skb_pull(skb, EM_HDR_LEN);
-
 		RT_TRACE(rtlpriv, (COMP_INTR | COMP_SEND), DBG_TRACE,
 			 "new ring->idx:%d, free: skb_queue_len:%d, free: seq:%x\n",
 			 ring->idx,
 			 skb_queue_len(&ring->queue),
 			 *(u16 *)(skb->data + 22));
 
-		if (prio == TXCMD_QUEUE) {
-			dev_kfree_skb(skb);
-			goto tx_status_ok;
+		__skb_queue_tail(done, skb);
+		count++;
+	}
+
+	if (count) {
+		ring->batch_stats.reclaims++;
+		ring->batch_stats.reclaimed += count;
+	}
+	return count;
+}
 
+static void _rtl_pci_tx_isr(struct ieee80211_hw *hw, int prio)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+
+	struct rtl8192_tx_ring *ring = &rtlpci->tx_ring[prio];
+	struct sk_buff_head done;
+	struct sk_buff *skb;
+	unsigned long wake_queues = 0;
+	unsigned long flags;
+	bool wake;
+	u32 count;
+	int i;
+
+	__skb_queue_head_init(&done);
+
+	spin_lock_irqsave(&ring->lock, flags);
+	/* with this little room left the queue was, or is about to be,
+	 * stopped by rtl_pci_tx()
+	 */
+	wake = (ring->entries - skb_queue_len(&ring->queue)) < 4;
+	count = _rtl_pci_tx_reclaim(hw, prio, &done);
+	spin_unlock_irqrestore(&ring->lock, flags);
+
+	rtlpci->irq_mod.frames += count;
+
+	while ((skb = __skb_dequeue(&done))) {
+		struct ieee80211_tx_info *info;
+		__le16 fc;
+		u8 tid;
+
+		/* remove early mode header */
+		if (rtlpriv->rtlhal.earlymode_enable)
+			skb_pull(skb, EM_HDR_LEN);
+
+		if (prio == TXCMD_QUEUE) {
+			dev_kfree_skb_any(skb);
+			continue;
 		}
 
+		if (wake)
+			__set_bit(skb_get_queue_mapping(skb), &wake_queues);
+
 		/* for sw LPS, just after NULL skb send out, we can
 		 * sure AP knows we are sleeping, we should not let
 		 * rf sleep
@@ -638,15 +715,21 @@ static void _rtl_pci_tx_isr(struct ieee80211_hw *hw, int prio)
 				(struct ieee80211_mgmt *)skb->data;
 			if (action_frame->u.action.u.ht_smps.action ==
 			    WLAN_HT_ACTION_SMPS) {
-				dev_kfree_skb(skb);
-				goto tx_status_ok;
+				dev_kfree_skb_any(skb);
+				continue;
 			}
 		}
 
 		/* update tid tx pkt num */
 		tid = rtl_get_tid(skb);
 		if (tid <= 7)
-			rtlpriv->link_info.tidtx_inperiod[tid]++;
+			rtl_data_stats_add(rtlpriv, tidtx[tid], 1);
+
+		/* frames waiting for a firmware TX report get their
+		 * status from rtl_tx_report_handler()
+		 */
+		if (rtl_tx_report_hold(hw, skb))
+			continue;
 
 		info = IEEE80211_SKB_CB(skb);
 		ieee80211_tx_info_clear_status(info);
@@ -655,55 +738,28 @@ static void _rtl_pci_tx_isr(struct ieee80211_hw *hw, int prio)
 		/*info->status.rates[0].count = 1; */
 
 		ieee80211_tx_status_irqsafe(hw, skb);
+	}
 
-		if ((ring->entries - skb_queue_len(&ring->queue)) <= 4) {
-
-			RT_TRACE(rtlpriv, COMP_ERR, DBG_DMESG,
-				 "more desc left, wake skb_queue@%d, ring->idx = %d, skb_queue_len = 0x%x\n",
-				 prio, ring->idx,
-				 skb_queue_len(&ring->queue));
+	for_each_set_bit(i, &wake_queues, IEEE80211_MAX_QUEUES) {
+		RT_TRACE(rtlpriv, COMP_ERR, DBG_DMESG,
+			 "more desc left, wake skb_queue@%d, ring->idx = %d, skb_queue_len = 0x%x\n",
+			 prio, ring->idx,
+			 skb_queue_len(&ring->queue));
 
-			ieee80211_wake_queue(hw,
-					skb_get_queue_mapping
-					(skb));
-		}
-tx_status_ok:
-		skb = NULL;
+		ieee80211_wake_queue(hw, i);
 	}
 
-	if (((rtlpriv->link_info.num_rx_inperiod +
-	      rtlpriv->link_info.num_tx_inperiod) > 8) ||
-	      (rtlpriv->link_info.num_rx_inperiod > 2))
-		rtl_lps_leave(hw);
+	if (prio <= VO_QUEUE)
+		rtl_ps_gov_check(hw);
 }
 
-static int _rtl_pci_init_one_rxdesc(struct ieee80211_hw *hw,
-				    struct sk_buff *new_skb, u8 *entry,
-				    int rxring_idx, int desc_idx)
+static void _rtl_pci_set_rxdesc(struct ieee80211_hw *hw, u8 *entry,
+				u32 bufferaddress)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
-	u32 bufferaddress;
 	u8 tmp_one = 1;
-	struct sk_buff *skb;
 
-	if (likely(new_skb)) {
-		skb = new_skb;
-		goto remap;
-	}
-	skb = dev_alloc_skb(rtlpci->rxbuffersize);
-	if (!skb)
-		return 0;
-
-remap:
-	/* just set skb->cb to mapping addr for pci_unmap_single use */
-	*((dma_addr_t *)skb->cb) =
-		pci_map_single(rtlpci->pdev, skb_tail_pointer(skb),
-			       rtlpci->rxbuffersize, PCI_DMA_FROMDEVICE);
-	bufferaddress = *((dma_addr_t *)skb->cb);
-	if (pci_dma_mapping_error(rtlpci->pdev, bufferaddress))
-		return 0;
-	rtlpci->rx_ring[rxring_idx].rx_buf[desc_idx] = skb;
 	if (rtlpriv->use_new_trx_flow) {
 		rtlpriv->cfg->ops->set_desc(hw, (u8 *)entry, false,
 					    HW_DESC_RX_PREPARE,
@@ -719,44 +775,104 @@ remap:
 					    HW_DESC_RXOWN,
 					    (u8 *)&tmp_one);
 	}
+}
+
+static struct sk_buff *_rtl_pci_alloc_rxbuf(struct ieee80211_hw *hw,
+					    gfp_t gfp_mask)
+{
+	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+	struct sk_buff *skb;
+	dma_addr_t bufferaddress;
+
+	skb = __dev_alloc_skb(rtlpci->rxbuffersize, gfp_mask);
+	if (!skb)
+		return NULL;
+
+	/* just set skb->cb to mapping addr for pci_unmap_single use */
+	bufferaddress = pci_map_single(rtlpci->pdev, skb_tail_pointer(skb),
+				       rtlpci->rxbuffersize,
+				       PCI_DMA_FROMDEVICE);
+	if (pci_dma_mapping_error(rtlpci->pdev, bufferaddress)) {
+		dev_kfree_skb_any(skb);
+		return NULL;
+	}
+	*((dma_addr_t *)skb->cb) = bufferaddress;
+
+	return skb;
+}
+
+/* new_skb must already be mapped, see _rtl_pci_alloc_rxbuf() */
+static int _rtl_pci_init_one_rxdesc(struct ieee80211_hw *hw,
+				    struct sk_buff *new_skb, u8 *entry,
+				    int rxring_idx, int desc_idx)
+{
+	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+	struct sk_buff *skb;
+
+	if (likely(new_skb))
+		skb = new_skb;
+	else
+		skb = _rtl_pci_alloc_rxbuf(hw, GFP_ATOMIC);
+	if (!skb)
+		return 0;
+
+	rtlpci->rx_ring[rxring_idx].rx_buf[desc_idx] = skb;
+	_rtl_pci_set_rxdesc(hw, entry, *((dma_addr_t *)skb->cb));
 	return 1;
 }
 
+/* In NAPI mode frames are collected during the poll and handed to
+ * mac80211 in one batch by _rtl_pci_napi_rx_flush(), otherwise they
+ * are queued to the mac80211 tasklet as before.
+ */
+static void _rtl_pci_rx_deliver(struct ieee80211_hw *hw, struct sk_buff *skb)
+{
+	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+
+	if (rtlpci->napi_enabled)
+		__skb_queue_tail(&rtlpci->napi_rx_list, skb);
+	else
+		ieee80211_rx_irqsafe(hw, skb);
+}
+
 /* inorder to receive 8K AMSDU we have set skb to
- * 9100bytes in init rx ring, but if this packet is
- * not a AMSDU, this large packet will be sent to
- * TCP/IP directly, this cause big packet ping fail
- * like: "ping -s 65507", so here we will realloc skb
- * based on the true size of packet, Mac80211
- * Probably will do it better, but does not yet.
- *
- * Some platform will fail when alloc skb sometimes.
- * in this condition, we will send the old skb to
- * mac80211 directly, this will not cause any other
- * issues, but only this packet will be lost by TCP/IP
+ * 9100bytes in init rx ring, but if a packet is sent
+ * to TCP/IP in such a buffer, its truesize is many
+ * times its length and this cause big packet ping fail
+ * like: "ping -s 65507". So every frame is copied into
+ * an skb of its true size by _rtl_pci_rx_get_frame(),
+ * and the ring buffer is given back to the hardware
+ * as it is.
  */
 static void _rtl_pci_rx_to_mac80211(struct ieee80211_hw *hw,
-				    struct sk_buff *skb,
-				    struct ieee80211_rx_status rx_status)
+				    struct sk_buff *skb)
 {
-	if (unlikely(!rtl_action_proc(hw, skb, false))) {
+	if (unlikely(!rtl_action_proc(hw, skb, false)))
 		dev_kfree_skb_any(skb);
-	} else {
-		struct sk_buff *uskb = NULL;
-		u8 *pdata;
+	else
+		_rtl_pci_rx_deliver(hw, skb);
+}
 
-		uskb = dev_alloc_skb(skb->len + 128);
-		if (likely(uskb)) {
-			memcpy(IEEE80211_SKB_RXCB(uskb), &rx_status,
-			       sizeof(rx_status));
-			pdata = (u8 *)skb_put(uskb, skb->len);
-			memcpy(pdata, skb->data, skb->len);
-			dev_kfree_skb_any(skb);
-			ieee80211_rx_irqsafe(hw, uskb);
-		} else {
-			ieee80211_rx_irqsafe(hw, skb);
-		}
+/* Returns a copy of the frame received in rxbuf. Frames that fit in a
+ * page are copied into the page fragment cache, so the copy is charged
+ * about its own size, and rxbuf stays mapped in its ring slot.
+ */
+static struct sk_buff *_rtl_pci_rx_get_frame(struct ieee80211_hw *hw,
+					     struct sk_buff *rxbuf,
+					     u16 len, u32 offset)
+{
+	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+	struct sk_buff *skb;
+
+	skb = dev_alloc_skb(len);
+	if (unlikely(!skb)) {
+		rtlpci->rx_copy_fails++;
+		return NULL;
 	}
+
+	memcpy(skb_put(skb, len), rxbuf->data + offset, len);
+	rtlpci->rx_copied++;
+	return skb;
 }
 
 /*hsisr interrupt handler*/
@@ -770,25 +886,26 @@ static void _rtl_pci_hs_interrupt(struct ieee80211_hw *hw)
 		       rtlpci->sys_irq_mask);
 }
 
-static void _rtl_pci_rx_interrupt(struct ieee80211_hw *hw)
+static int _rtl_pci_rx_interrupt(struct ieee80211_hw *hw, int budget)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
 	int rxring_idx = RTL_PCI_RX_MPDU_QUEUE;
 	struct ieee80211_rx_status rx_status = { 0 };
-	unsigned int count = rtlpci->rxringcount;
+	int count = 0;
 	u8 own;
 	u8 tmp_one;
 	bool unicast = false;
 	u8 hw_queue = 0;
 	unsigned int rx_remained_cnt;
+	struct rtl_rx_mgmt rx_mgmt;
 	struct rtl_stats stats = {
 		.signal = 0,
 		.rate = 0,
 	};
 
 	/*RX NORMAL PKT */
-	while (count--) {
+	while (count < budget) {
 		struct ieee80211_hdr *hdr;
 		__le16 fc;
 		u16 len;
@@ -797,19 +914,21 @@ static void _rtl_pci_rx_interrupt(struct ieee80211_hw *hw)
 		/*if use new trx flow, it means wifi info */
 		struct rtl_rx_desc *pdesc = NULL;
 		/*rx pkt */
-		struct sk_buff *skb = rtlpci->rx_ring[rxring_idx].rx_buf[
-				      rtlpci->rx_ring[rxring_idx].idx];
-		struct sk_buff *new_skb;
+		struct sk_buff *rxbuf = rtlpci->rx_ring[rxring_idx].rx_buf[
+					rtlpci->rx_ring[rxring_idx].idx];
+		struct sk_buff *skb;
+		dma_addr_t dma_addr;
+		u32 offset;
 
 		if (rtlpriv->use_new_trx_flow) {
 			rx_remained_cnt =
 				rtlpriv->cfg->ops->rx_desc_buff_remained_cnt(hw,
 								      hw_queue);
 			if (rx_remained_cnt == 0)
-				return;
+				break;
 			buffer_desc = &rtlpci->rx_ring[rxring_idx].buffer_desc[
 				rtlpci->rx_ring[rxring_idx].idx];
-			pdesc = (struct rtl_rx_desc *)skb->data;
+			pdesc = (struct rtl_rx_desc *)rxbuf->data;
 		} else {	/* rx descriptor */
 			pdesc = &rtlpci->rx_ring[rxring_idx].desc[
 				rtlpci->rx_ring[rxring_idx].idx];
@@ -818,23 +937,21 @@ static void _rtl_pci_rx_interrupt(struct ieee80211_hw *hw)
 							      false,
 							      HW_DESC_OWN);
 			if (own) /* wait data to be filled by hardware */
-				return;
+				break;
 		}
 
 		/* Reaching this point means: data is filled already
 		 * AAAAAAttention !!!
-		 * We can NOT access 'skb' before 'pci_unmap_single'
+		 * We can NOT access 'rxbuf' before it is synced for cpu
 		 */
-		pci_unmap_single(rtlpci->pdev, *((dma_addr_t *)skb->cb),
-				 rtlpci->rxbuffersize, PCI_DMA_FROMDEVICE);
+		dma_addr = *((dma_addr_t *)rxbuf->cb);
+		pci_dma_sync_single_for_cpu(rtlpci->pdev, dma_addr,
+					    rtlpci->rxbuffersize,
+					    PCI_DMA_FROMDEVICE);
 
-		/* get a new skb - if fail, old one will be reused */
-		new_skb = dev_alloc_skb(rtlpci->rxbuffersize);
-		if (unlikely(!new_skb))
-			goto no_new;
 		memset(&rx_status , 0 , sizeof(rx_status));
 		rtlpriv->cfg->ops->query_rx_desc(hw, &stats,
-						 &rx_status, (u8 *)pdesc, skb);
+						 &rx_status, (u8 *)pdesc, rxbuf);
 
 		if (rtlpriv->use_new_trx_flow)
 			rtlpriv->cfg->ops->rx_check_dma_ok(hw,
@@ -844,21 +961,23 @@ static void _rtl_pci_rx_interrupt(struct ieee80211_hw *hw)
 		len = rtlpriv->cfg->ops->get_desc((u8 *)pdesc, false,
 						  HW_DESC_RXPKT_LEN);
 
-		if (skb->end - skb->tail > len) {
-			skb_put(skb, len);
-			if (rtlpriv->use_new_trx_flow)
-				skb_reserve(skb, stats.rx_drvinfo_size +
-					    stats.rx_bufshift + 24);
-			else
-				skb_reserve(skb, stats.rx_drvinfo_size +
-					    stats.rx_bufshift);
-		} else {
+		if (rtlpriv->use_new_trx_flow)
+			offset = stats.rx_drvinfo_size + stats.rx_bufshift + 24;
+		else
+			offset = stats.rx_drvinfo_size + stats.rx_bufshift;
+
+		if (rxbuf->end - rxbuf->tail <= len) {
 			RT_TRACE(rtlpriv, COMP_ERR, DBG_WARNING,
 				 "skb->end - skb->tail = %d, len is %d\n",
-				 skb->end - skb->tail, len);
-			dev_kfree_skb_any(skb);
+				 rxbuf->end - rxbuf->tail, len);
 			goto new_trx_end;
 		}
+
+		/* if this fails the frame is lost and rxbuf is reused */
+		skb = _rtl_pci_rx_get_frame(hw, rxbuf, len, offset);
+		if (unlikely(!skb))
+			goto new_trx_end;
+
 		/* handle command packet here */
 		if (rtlpriv->cfg->ops->rx_command_packet &&
 		    rtlpriv->cfg->ops->rx_command_packet(hw, &stats, skb)) {
@@ -886,24 +1005,29 @@ static void _rtl_pci_rx_interrupt(struct ieee80211_hw *hw)
 				;/*TODO*/
 			} else {
 				unicast = true;
-				rtlpriv->stats.rxbytesunicast += skb->len;
+				rtl_data_stats_add(rtlpriv, rx_bytes_unicast,
+						   skb->len);
 			}
 			rtl_is_special_data(hw, skb, false, true);
 
 			if (ieee80211_is_data(fc)) {
 				rtlpriv->cfg->ops->led_control(hw, LED_CTL_RX);
-				if (unicast)
-					rtlpriv->link_info.num_rx_inperiod++;
+				if (unicast) {
+					rtl_traffic_rx(hw, skb);
+					rtl_ps_gov_check(hw);
+				}
 			}
 
-			rtl_collect_scan_list(hw, skb);
+			rtl_parse_rx_mgmt(hw, skb, &rx_mgmt, true);
+			rtl_collect_scan_list(hw, &rx_mgmt);
 
 			/* static bcn for roaming */
-			rtl_beacon_statistic(hw, skb);
-			rtl_p2p_info(hw, (void *)skb->data, skb->len);
+			rtl_beacon_statistic(hw, &rx_mgmt);
+			rtl_p2p_info(hw, &rx_mgmt);
 			/* for sw lps */
-			rtl_swlps_beacon(hw, (void *)skb->data, skb->len);
-			rtl_recognize_peer(hw, (void *)skb->data, skb->len);
+			rtl_swlps_beacon(hw, &rx_mgmt);
+			rtl_recognize_peer(hw, &rx_mgmt);
+			rtl_rx_mgmt_done(hw, &rx_mgmt);
 			if ((rtlpriv->mac80211.opmode == NL80211_IFTYPE_AP) &&
 			    (rtlpriv->rtlhal.current_bandtype ==
 			     BAND_ON_2_4G) &&
@@ -911,7 +1035,7 @@ static void _rtl_pci_rx_interrupt(struct ieee80211_hw *hw)
 			     ieee80211_is_probe_resp(fc))) {
 				dev_kfree_skb_any(skb);
 			} else {
-				_rtl_pci_rx_to_mac80211(hw, skb, rx_status);
+				_rtl_pci_rx_to_mac80211(hw, skb);
 			}
 		} else {
 			dev_kfree_skb_any(skb);
@@ -926,18 +1050,16 @@ new_trx_end:
 			rtl_write_word(rtlpriv, 0x3B4,
 				       rtlpci->rx_ring[hw_queue].next_rx_rp);
 		}
-		if (((rtlpriv->link_info.num_rx_inperiod +
-		      rtlpriv->link_info.num_tx_inperiod) > 8) ||
-		      (rtlpriv->link_info.num_rx_inperiod > 2))
-			rtl_lps_leave(hw);
-		skb = new_skb;
-no_new:
+
+		pci_dma_sync_single_for_device(rtlpci->pdev, dma_addr,
+					       rtlpci->rxbuffersize,
+					       PCI_DMA_FROMDEVICE);
 		if (rtlpriv->use_new_trx_flow) {
-			_rtl_pci_init_one_rxdesc(hw, skb, (u8 *)buffer_desc,
+			_rtl_pci_init_one_rxdesc(hw, rxbuf, (u8 *)buffer_desc,
 						 rxring_idx,
 						 rtlpci->rx_ring[rxring_idx].idx);
 		} else {
-			_rtl_pci_init_one_rxdesc(hw, skb, (u8 *)pdesc,
+			_rtl_pci_init_one_rxdesc(hw, rxbuf, (u8 *)pdesc,
 						 rxring_idx,
 						 rtlpci->rx_ring[rxring_idx].idx);
 			if (rtlpci->rx_ring[rxring_idx].idx ==
@@ -950,57 +1072,297 @@ no_new:
 		rtlpci->rx_ring[rxring_idx].idx =
 				(rtlpci->rx_ring[rxring_idx].idx + 1) %
 				rtlpci->rxringcount;
+		count++;
 	}
+
+	rtlpci->irq_mod.frames += count;
+	return count;
 }
 
-static irqreturn_t _rtl_pci_interrupt(int irq, void *dev_id)
+static void _rtl_pci_irq_mod_set(struct ieee80211_hw *hw, bool active)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_pci_irq_mod *mod = &rtl_pcidev(rtl_pcipriv(hw))->irq_mod;
+
+	if (mod->active == active)
+		return;
+
+	mod->active = active;
+	mod->switches++;
+	if (rtlpriv->cfg->hw_int_migration)
+		rtlpriv->cfg->ops->set_hw_reg(hw, HW_VAR_INT_MIGRATION,
+					      (u8 *)&active);
+
+	RT_TRACE(rtlpriv, COMP_INTR, DBG_LOUD,
+		 "interrupt moderation %s at %u frames/s\n",
+		 active ? "on" : "off", mod->frames_per_sec);
+}
+
+/* Called once a second from the interrupt path */
+static void _rtl_pci_irq_mod_window(struct ieee80211_hw *hw, u32 irq_per_sec)
+{
+	struct rtl_pci_irq_mod *mod = &rtl_pcidev(rtl_pcipriv(hw))->irq_mod;
+	bool active;
+
+	mod->frames_per_sec = mod->frames_in_window;
+	mod->frames_in_window = 0;
+	mod->rate_hist[min_t(int, fls(irq_per_sec / 1000),
+			     RTL_PCI_IRQ_HIST_SIZE - 1)]++;
+
+	switch (READ_ONCE(rtl_pci_irq_mod)) {
+	case 0:
+		active = false;
+		break;
+	case 2:
+		active = true;
+		break;
+	default:
+		/* the two thresholds keep it from flapping */
+		if (mod->frames_per_sec >= READ_ONCE(rtl_pci_irq_mod_high))
+			active = true;
+		else if (mod->frames_per_sec < READ_ONCE(rtl_pci_irq_mod_low))
+			active = false;
+		else
+			active = mod->active;
+		break;
+	}
+
+	_rtl_pci_irq_mod_set(hw, active);
+}
+
+static void _rtl_pci_count_interrupt(struct ieee80211_hw *hw)
 {
-	struct ieee80211_hw *hw = dev_id;
 	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+	struct rtl_pci_napi_stats *stats = &rtlpci->napi_stats;
+	struct rtl_pci_irq_mod *mod = &rtlpci->irq_mod;
+
+	/* what the previous interrupt ended up servicing */
+	mod->frames_hist[min_t(int, fls(mod->frames),
+			       RTL_PCI_IRQ_HIST_SIZE - 1)]++;
+	mod->frames_in_window += mod->frames;
+	mod->frames = 0;
+
+	stats->interrupts++;
+	stats->irq_in_window++;
+	if (time_after(jiffies, stats->window_start + HZ)) {
+		stats->irq_per_sec = stats->irq_in_window;
+		stats->irq_in_window = 0;
+		stats->window_start = jiffies;
+		_rtl_pci_irq_mod_window(hw, stats->irq_per_sec);
+	}
+}
+
+/* Unmasks the interrupt once its causes have been serviced. While
+ * moderation is active on a chip without interrupt migration this is
+ * delayed by the software hold-off. Called with irq_th_lock held.
+ */
+static void _rtl_pci_irq_reenable(struct ieee80211_hw *hw)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_pci_irq_mod *mod = &rtl_pcidev(rtl_pcipriv(hw))->irq_mod;
+	unsigned int holdoff = READ_ONCE(rtl_pci_irq_holdoff);
+
+	if (mod->active && !rtlpriv->cfg->hw_int_migration && holdoff) {
+		mod->holdoffs++;
+		hrtimer_start(&mod->holdoff_timer,
+			      ns_to_ktime((u64)holdoff * NSEC_PER_USEC),
+			      HRTIMER_MODE_REL);
+		return;
+	}
+
+	rtlpriv->cfg->ops->enable_interrupt(hw);
+}
+
+static enum hrtimer_restart _rtl_pci_irq_holdoff_callback(struct hrtimer *timer)
+{
+	struct rtl_pci *rtlpci = container_of(timer, struct rtl_pci,
+					      irq_mod.holdoff_timer);
+	struct ieee80211_hw *hw = rtlpci->hw;
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
-	struct rtl_hal *rtlhal = rtl_hal(rtl_priv(hw));
 	unsigned long flags;
-	u32 inta = 0;
-	u32 intb = 0;
-	irqreturn_t ret = IRQ_HANDLED;
 
-	if (rtlpci->irq_enabled == 0)
-		return ret;
+	spin_lock_irqsave(&rtlpriv->locks.irq_th_lock, flags);
+	if (!is_hal_stop(rtl_hal(rtlpriv)))
+		rtlpriv->cfg->ops->enable_interrupt(hw);
+	spin_unlock_irqrestore(&rtlpriv->locks.irq_th_lock, flags);
 
-	spin_lock_irqsave(&rtlpriv->locks.irq_th_lock , flags);
-	rtlpriv->cfg->ops->disable_interrupt(hw);
+	return HRTIMER_NORESTART;
+}
 
-	/*read ISR: 4/8bytes */
-	rtlpriv->cfg->ops->interrupt_recognized(hw, &inta, &intb);
+/* Called from the hard IRQ with the interrupt already masked. Returns
+ * true when a poll has been scheduled, in which case the interrupt must
+ * stay masked until the poll re-enables it.
+ */
+static bool _rtl_pci_napi_schedule(struct ieee80211_hw *hw, u32 inta, u32 intb)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+	struct rtl_hal *rtlhal = rtl_hal(rtl_priv(hw));
+	u32 data_dok = rtlpriv->cfg->maps[RTL_IMR_BKDOK] |
+		       rtlpriv->cfg->maps[RTL_IMR_BEDOK] |
+		       rtlpriv->cfg->maps[RTL_IMR_VIDOK] |
+		       rtlpriv->cfg->maps[RTL_IMR_VODOK];
+	u32 trx_mask = data_dok |
+		       rtlpriv->cfg->maps[RTL_IMR_MGNTDOK] |
+		       rtlpriv->cfg->maps[RTL_IMR_HIGHDOK] |
+		       rtlpriv->cfg->maps[RTL_IMR_ROK] |
+		       rtlpriv->cfg->maps[RTL_IMR_RDU];
 
-	/*Shared IRQ or HW disappared */
-	if (!inta || inta == 0xffff)
-		goto done;
+	if (rtlhal->hw_type == HARDWARE_TYPE_RTL8192SE)
+		trx_mask |= rtlpriv->cfg->maps[RTL_IMR_COMDOK];
 
-	/*<1> beacon related */
-	if (inta & rtlpriv->cfg->maps[RTL_IMR_TBDOK]) {
-		RT_TRACE(rtlpriv, COMP_INTR, DBG_TRACE,
-			 "beacon ok interrupt!\n");
-	}
+	if (!(inta & trx_mask) &&
+	    !(intb & rtlpriv->cfg->maps[RTL_IMR_RXFOVW]))
+		return false;
 
-	if (unlikely(inta & rtlpriv->cfg->maps[RTL_IMR_TBDER])) {
-		RT_TRACE(rtlpriv, COMP_INTR, DBG_TRACE,
-			 "beacon err interrupt!\n");
+	if (inta & data_dok)
+		rtl_data_stats_add(rtlpriv, tx_data, 1);
+
+	if (!napi_schedule_prep(&rtlpci->napi))
+		return false;
+
+	__napi_schedule(&rtlpci->napi);
+	return true;
+}
+
+static void _rtl_pci_napi_rx_flush(struct ieee80211_hw *hw)
+{
+	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+	struct sk_buff *skb;
+
+	while ((skb = __skb_dequeue(&rtlpci->napi_rx_list))) {
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 5, 0)
+		ieee80211_rx_napi(hw, NULL, skb, &rtlpci->napi);
+#else
+		ieee80211_rx(hw, skb);
+#endif
 	}
+}
 
-	if (inta & rtlpriv->cfg->maps[RTL_IMR_BDOK]) {
-		RT_TRACE(rtlpriv, COMP_INTR, DBG_TRACE, "beacon interrupt!\n");
+static int _rtl_pci_napi_poll(struct napi_struct *napi, int budget)
+{
+	struct rtl_pci *rtlpci = container_of(napi, struct rtl_pci, napi);
+	struct ieee80211_hw *hw = rtlpci->hw;
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_hal *rtlhal = rtl_hal(rtl_priv(hw));
+	unsigned long flags;
+	int work_done;
+	bool complete = true;
+
+	rtlpci->napi_stats.polls++;
+
+	/* reclaim every TX ring, an empty ring costs nothing */
+	_rtl_pci_tx_isr(hw, MGNT_QUEUE);
+	_rtl_pci_tx_isr(hw, HIGH_QUEUE);
+	_rtl_pci_tx_isr(hw, BK_QUEUE);
+	_rtl_pci_tx_isr(hw, BE_QUEUE);
+	_rtl_pci_tx_isr(hw, VI_QUEUE);
+	_rtl_pci_tx_isr(hw, VO_QUEUE);
+	if (rtlhal->hw_type == HARDWARE_TYPE_RTL8192SE)
+		_rtl_pci_tx_isr(hw, TXCMD_QUEUE);
+
+	work_done = _rtl_pci_rx_interrupt(hw, budget);
+	rtlpci->napi_stats.rx_frames += work_done;
+	_rtl_pci_napi_rx_flush(hw);
+
+	if (work_done >= budget) {
+		rtlpci->napi_stats.budget_exhausted++;
+		return budget;
 	}
 
-	if (inta & rtlpriv->cfg->maps[RTL_IMR_BCNINT]) {
-		RT_TRACE(rtlpriv, COMP_INTR, DBG_TRACE,
-			 "prepare beacon for interrupt!\n");
-		tasklet_schedule(&rtlpriv->works.irq_prepare_bcn_tasklet);
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 10, 0)
+	complete = napi_complete_done(napi, work_done);
+#else
+	napi_complete_done(napi, work_done);
+#endif
+	if (complete) {
+		spin_lock_irqsave(&rtlpriv->locks.irq_th_lock, flags);
+		_rtl_pci_irq_reenable(hw);
+		spin_unlock_irqrestore(&rtlpriv->locks.irq_th_lock, flags);
 	}
 
-	/*<2> Tx related */
-	if (unlikely(intb & rtlpriv->cfg->maps[RTL_IMR_TXFOVW]))
-		RT_TRACE(rtlpriv, COMP_ERR, DBG_WARNING, "IMR_TXFOVW!\n");
+	return work_done;
+}
+
+static int _rtl_pci_napi_init(struct ieee80211_hw *hw)
+{
+	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+
+	skb_queue_head_init(&rtlpci->napi_rx_list);
+	if (!rtl_pci_napi)
+		return 0;
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 10, 0)
+	rtlpci->napi_dev = alloc_netdev_dummy(0);
+#else
+	rtlpci->napi_dev = kzalloc(sizeof(*rtlpci->napi_dev), GFP_KERNEL);
+	if (rtlpci->napi_dev)
+		init_dummy_netdev(rtlpci->napi_dev);
+#endif
+	if (!rtlpci->napi_dev)
+		return -ENOMEM;
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 1, 0)
+	netif_napi_add(rtlpci->napi_dev, &rtlpci->napi, _rtl_pci_napi_poll);
+#else
+	netif_napi_add(rtlpci->napi_dev, &rtlpci->napi, _rtl_pci_napi_poll,
+		       RTL_PCI_NAPI_WEIGHT);
+#endif
+	rtlpci->napi_support = true;
+	return 0;
+}
+
+static void _rtl_pci_napi_deinit(struct ieee80211_hw *hw)
+{
+	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+
+	if (!rtlpci->napi_support)
+		return;
+
+	netif_napi_del(&rtlpci->napi);
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 10, 0)
+	free_netdev(rtlpci->napi_dev);
+#else
+	kfree(rtlpci->napi_dev);
+#endif
+	rtlpci->napi_dev = NULL;
+	rtlpci->napi_support = false;
+}
+
+static void _rtl_pci_napi_start(struct ieee80211_hw *hw)
+{
+	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+
+	if (!rtlpci->napi_support || rtlpci->napi_enabled)
+		return;
+
+	napi_enable(&rtlpci->napi);
+	rtlpci->napi_enabled = true;
+}
+
+/* Must run before the interrupt is disabled, a poll in flight
+ * re-enables it when it completes.
+ */
+static void _rtl_pci_napi_stop(struct ieee80211_hw *hw)
+{
+	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+
+	if (!rtlpci->napi_enabled)
+		return;
+
+	napi_disable(&rtlpci->napi);
+	rtlpci->napi_enabled = false;
+	__skb_queue_purge(&rtlpci->napi_rx_list);
+}
+
+/* TX completion and RX handling done directly from the hard IRQ,
+ * used when NAPI is not enabled.
+ */
+static void _rtl_pci_trx_interrupt(struct ieee80211_hw *hw, u32 inta, u32 intb)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+	struct rtl_hal *rtlhal = rtl_hal(rtl_priv(hw));
 
 	if (inta & rtlpriv->cfg->maps[RTL_IMR_MGNTDOK]) {
 		RT_TRACE(rtlpriv, COMP_INTR, DBG_TRACE,
@@ -1015,7 +1377,7 @@ static irqreturn_t _rtl_pci_interrupt(int irq, void *dev_id)
 	}
 
 	if (inta & rtlpriv->cfg->maps[RTL_IMR_BKDOK]) {
-		rtlpriv->link_info.num_tx_inperiod++;
+		rtl_data_stats_add(rtlpriv, tx_data, 1);
 
 		RT_TRACE(rtlpriv, COMP_INTR, DBG_TRACE,
 			 "BK Tx OK interrupt!\n");
@@ -1023,7 +1385,7 @@ static irqreturn_t _rtl_pci_interrupt(int irq, void *dev_id)
 	}
 
 	if (inta & rtlpriv->cfg->maps[RTL_IMR_BEDOK]) {
-		rtlpriv->link_info.num_tx_inperiod++;
+		rtl_data_stats_add(rtlpriv, tx_data, 1);
 
 		RT_TRACE(rtlpriv, COMP_INTR, DBG_TRACE,
 			 "BE TX OK interrupt!\n");
@@ -1031,7 +1393,7 @@ static irqreturn_t _rtl_pci_interrupt(int irq, void *dev_id)
 	}
 
 	if (inta & rtlpriv->cfg->maps[RTL_IMR_VIDOK]) {
-		rtlpriv->link_info.num_tx_inperiod++;
+		rtl_data_stats_add(rtlpriv, tx_data, 1);
 
 		RT_TRACE(rtlpriv, COMP_INTR, DBG_TRACE,
 			 "VI TX OK interrupt!\n");
@@ -1039,7 +1401,7 @@ static irqreturn_t _rtl_pci_interrupt(int irq, void *dev_id)
 	}
 
 	if (inta & rtlpriv->cfg->maps[RTL_IMR_VODOK]) {
-		rtlpriv->link_info.num_tx_inperiod++;
+		rtl_data_stats_add(rtlpriv, tx_data, 1);
 
 		RT_TRACE(rtlpriv, COMP_INTR, DBG_TRACE,
 			 "Vo TX OK interrupt!\n");
@@ -1048,7 +1410,7 @@ static irqreturn_t _rtl_pci_interrupt(int irq, void *dev_id)
 
 	if (rtlhal->hw_type == HARDWARE_TYPE_RTL8192SE) {
 		if (inta & rtlpriv->cfg->maps[RTL_IMR_COMDOK]) {
-			rtlpriv->link_info.num_tx_inperiod++;
+			rtl_data_stats_add(rtlpriv, tx_data, 1);
 
 			RT_TRACE(rtlpriv, COMP_INTR, DBG_TRACE,
 				 "CMD TX OK interrupt!\n");
@@ -1059,19 +1421,64 @@ static irqreturn_t _rtl_pci_interrupt(int irq, void *dev_id)
 	/*<3> Rx related */
 	if (inta & rtlpriv->cfg->maps[RTL_IMR_ROK]) {
 		RT_TRACE(rtlpriv, COMP_INTR, DBG_TRACE, "Rx ok interrupt!\n");
-		_rtl_pci_rx_interrupt(hw);
+		_rtl_pci_rx_interrupt(hw, rtlpci->rxringcount);
 	}
 
 	if (unlikely(inta & rtlpriv->cfg->maps[RTL_IMR_RDU])) {
 		RT_TRACE(rtlpriv, COMP_ERR, DBG_WARNING,
 			 "rx descriptor unavailable!\n");
-		_rtl_pci_rx_interrupt(hw);
+		_rtl_pci_rx_interrupt(hw, rtlpci->rxringcount);
 	}
 
 	if (unlikely(intb & rtlpriv->cfg->maps[RTL_IMR_RXFOVW])) {
 		RT_TRACE(rtlpriv, COMP_ERR, DBG_WARNING, "rx overflow !\n");
-		_rtl_pci_rx_interrupt(hw);
+		_rtl_pci_rx_interrupt(hw, rtlpci->rxringcount);
 	}
+}
+
+/* Services the causes of one interrupt. Runs with the interrupt masked,
+ * either in hard IRQ context or from the IRQ thread.
+ */
+static void _rtl_pci_handle_interrupt(struct ieee80211_hw *hw,
+				      u32 inta, u32 intb)
+{
+	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_hal *rtlhal = rtl_hal(rtl_priv(hw));
+	unsigned long flags;
+	bool napi_sched = false;
+
+	_rtl_pci_count_interrupt(hw);
+
+	/*<1> beacon related */
+	if (inta & rtlpriv->cfg->maps[RTL_IMR_TBDOK]) {
+		RT_TRACE(rtlpriv, COMP_INTR, DBG_TRACE,
+			 "beacon ok interrupt!\n");
+	}
+
+	if (unlikely(inta & rtlpriv->cfg->maps[RTL_IMR_TBDER])) {
+		RT_TRACE(rtlpriv, COMP_INTR, DBG_TRACE,
+			 "beacon err interrupt!\n");
+	}
+
+	if (inta & rtlpriv->cfg->maps[RTL_IMR_BDOK]) {
+		RT_TRACE(rtlpriv, COMP_INTR, DBG_TRACE, "beacon interrupt!\n");
+	}
+
+	if (inta & rtlpriv->cfg->maps[RTL_IMR_BCNINT]) {
+		RT_TRACE(rtlpriv, COMP_INTR, DBG_TRACE,
+			 "prepare beacon for interrupt!\n");
+		tasklet_schedule(&rtlpriv->works.irq_prepare_bcn_tasklet);
+	}
+
+	/*<2> Tx related */
+	if (unlikely(intb & rtlpriv->cfg->maps[RTL_IMR_TXFOVW]))
+		RT_TRACE(rtlpriv, COMP_ERR, DBG_WARNING, "IMR_TXFOVW!\n");
+
+	if (rtlpci->napi_enabled)
+		napi_sched = _rtl_pci_napi_schedule(hw, inta, intb);
+	else
+		_rtl_pci_trx_interrupt(hw, inta, intb);
 
 	/*<4> fw related*/
 	if (rtlhal->hw_type == HARDWARE_TYPE_RTL8723AE) {
@@ -1101,10 +1508,76 @@ static irqreturn_t _rtl_pci_interrupt(int irq, void *dev_id)
 	if (rtlpriv->rtlhal.earlymode_enable)
 		tasklet_schedule(&rtlpriv->works.irq_tasklet);
 
-done:
-	rtlpriv->cfg->ops->enable_interrupt(hw);
+	spin_lock_irqsave(&rtlpriv->locks.irq_th_lock, flags);
+	/* with a poll pending, interrupts stay masked until it completes */
+	if (!napi_sched)
+		_rtl_pci_irq_reenable(hw);
 	spin_unlock_irqrestore(&rtlpriv->locks.irq_th_lock, flags);
-	return ret;
+}
+
+static irqreturn_t _rtl_pci_interrupt(int irq, void *dev_id)
+{
+	struct ieee80211_hw *hw = dev_id;
+	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	unsigned long flags;
+	u32 inta = 0;
+	u32 intb = 0;
+
+	if (rtlpci->irq_enabled == 0)
+		return IRQ_HANDLED;
+
+	spin_lock_irqsave(&rtlpriv->locks.irq_th_lock , flags);
+	rtlpriv->cfg->ops->disable_interrupt(hw);
+
+	/*read ISR: 4/8bytes */
+	rtlpriv->cfg->ops->interrupt_recognized(hw, &inta, &intb);
+
+	/*Shared IRQ or HW disappared */
+	if (!inta || inta == 0xffff) {
+		rtlpriv->cfg->ops->enable_interrupt(hw);
+		spin_unlock_irqrestore(&rtlpriv->locks.irq_th_lock, flags);
+		return IRQ_HANDLED;
+	}
+
+	if (rtlpci->irq_threaded) {
+		/* the thread unmasks the interrupt when it is done */
+		rtlpci->irq_inta |= inta;
+		rtlpci->irq_intb |= intb;
+		spin_unlock_irqrestore(&rtlpriv->locks.irq_th_lock, flags);
+		return IRQ_WAKE_THREAD;
+	}
+
+	/* Only the interrupt registers need irq_th_lock, the rings have
+	 * their own locks. The interrupt stays masked meanwhile.
+	 */
+	spin_unlock_irqrestore(&rtlpriv->locks.irq_th_lock, flags);
+
+	_rtl_pci_handle_interrupt(hw, inta, intb);
+	return IRQ_HANDLED;
+}
+
+static irqreturn_t _rtl_pci_interrupt_thread(int irq, void *dev_id)
+{
+	struct ieee80211_hw *hw = dev_id;
+	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	unsigned long flags;
+	u32 inta, intb;
+
+	spin_lock_irqsave(&rtlpriv->locks.irq_th_lock, flags);
+	inta = rtlpci->irq_inta;
+	intb = rtlpci->irq_intb;
+	rtlpci->irq_inta = 0;
+	rtlpci->irq_intb = 0;
+	spin_unlock_irqrestore(&rtlpriv->locks.irq_th_lock, flags);
+
+	/* mac80211 expects the RX/TX status path to run with BHs off */
+	local_bh_disable();
+	_rtl_pci_handle_interrupt(hw, inta, intb);
+	local_bh_enable();
+
+	return IRQ_HANDLED;
 }
 
 static void _rtl_pci_irq_tasklet(struct ieee80211_hw *hw)
@@ -1127,14 +1600,17 @@ static void _rtl_pci_prepare_bcn_tasklet(struct ieee80211_hw *hw)
 	struct rtl_tx_buffer_desc *pbuffer_desc = NULL;
 	u8 temp_one = 1;
 	u8 *entry;
+	unsigned long flags;
 
 	memset(&tcb_desc, 0, sizeof(struct rtl_tcb_desc));
 	ring = &rtlpci->tx_ring[BEACON_QUEUE];
+	spin_lock_irqsave(&ring->lock, flags);
 	pskb = __skb_dequeue(&ring->queue);
 	if (rtlpriv->use_new_trx_flow)
 		entry = (u8 *)(&ring->buffer_desc[ring->idx]);
 	else
 		entry = (u8 *)(&ring->desc[ring->idx]);
+	spin_unlock_irqrestore(&ring->lock, flags);
 	if (pskb) {
 		pci_unmap_single(rtlpci->pdev,
 				 rtlpriv->cfg->ops->get_desc(
@@ -1153,6 +1629,7 @@ static void _rtl_pci_prepare_bcn_tasklet(struct ieee80211_hw *hw)
 	if (rtlpriv->use_new_trx_flow)
 		pbuffer_desc = &ring->buffer_desc[0];
 
+	spin_lock_irqsave(&ring->lock, flags);
 	rtlpriv->cfg->ops->fill_tx_desc(hw, hdr, (u8 *)pdesc,
 					(u8 *)pbuffer_desc, info, NULL, pskb,
 					BEACON_QUEUE, &tcb_desc);
@@ -1167,6 +1644,7 @@ static void _rtl_pci_prepare_bcn_tasklet(struct ieee80211_hw *hw)
 		rtlpriv->cfg->ops->set_desc(hw, (u8 *)pdesc, true, HW_DESC_OWN,
 					    &temp_one);
 	}
+	spin_unlock_irqrestore(&ring->lock, flags);
 	return;
 }
 
@@ -1203,6 +1681,68 @@ static void _rtl_pci_init_trx_var(struct ieee80211_hw *hw)
 	rtlpci->rxringcount = RTL_PCI_MAX_RX_COUNT;	/*64; */
 }
 
+/* Claims the doorbell of a ring with descriptors that have not been
+ * announced to the hardware yet. Called with ring->lock held.
+ */
+static bool _rtl_pci_tx_take_pending(struct rtl8192_tx_ring *ring)
+{
+	struct rtl_pci_tx_batch_stats *stats = &ring->batch_stats;
+
+	if (!ring->tx_pending)
+		return false;
+
+	if (ring->tx_pending > stats->max_batch)
+		stats->max_batch = ring->tx_pending;
+	ring->tx_pending = 0;
+	stats->doorbells++;
+	return true;
+}
+
+/* Rings the doorbell of every queue with pending descriptors, flush
+ * is set when this ends a burst that was never closed by its sender.
+ */
+static void _rtl_pci_tx_kick_pending(struct ieee80211_hw *hw, bool flush)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+	struct rtl8192_tx_ring *ring;
+	unsigned long flags;
+	bool kick;
+	int i;
+
+	for (i = 0; i < RTL_PCI_MAX_TX_QUEUE_COUNT; i++) {
+		ring = &rtlpci->tx_ring[i];
+		if (!READ_ONCE(ring->tx_pending))
+			continue;
+
+		spin_lock_irqsave(&ring->lock, flags);
+		kick = _rtl_pci_tx_take_pending(ring);
+		if (kick && flush)
+			ring->batch_stats.flushes++;
+		spin_unlock_irqrestore(&ring->lock, flags);
+
+		if (kick)
+			rtlpriv->cfg->ops->tx_polling(hw, i);
+	}
+}
+
+/* Bounds the latency of a burst whose last frame never came */
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 15, 0)
+static void _rtl_pci_tx_flush_timer_callback(struct timer_list *t)
+#else
+static void _rtl_pci_tx_flush_timer_callback(unsigned long data)
+#endif
+{
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 15, 0)
+	struct rtl_pci *rtlpci = from_timer(rtlpci, t, tx_flush_timer);
+	struct ieee80211_hw *hw = rtlpci->hw;
+#else
+	struct ieee80211_hw *hw = (struct ieee80211_hw *)data;
+#endif
+
+	_rtl_pci_tx_kick_pending(hw, true);
+}
+
 static void _rtl_pci_init_struct(struct ieee80211_hw *hw,
 		struct pci_dev *pdev)
 {
@@ -1215,6 +1755,7 @@ static void _rtl_pci_init_struct(struct ieee80211_hw *hw,
 	rtlpci->being_init_adapter = false;
 
 	rtlhal->hw = hw;
+	rtlpci->hw = hw;
 	rtlpci->pdev = pdev;
 
 	/*Tx/Rx related var */
@@ -1237,6 +1778,28 @@ static void _rtl_pci_init_struct(struct ieee80211_hw *hw,
 	/*QOS*/
 	rtlpci->acm_method = EACMWAY2_SW;
 
+	/*TX doorbell batching */
+	rtlpci->tx_batch = clamp(rtl_pci_tx_batch, 1, RTL_PCI_TX_BATCH_MAX);
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 15, 0)
+	timer_setup(&rtlpci->tx_flush_timer,
+		    _rtl_pci_tx_flush_timer_callback, 0);
+#else
+	setup_timer(&rtlpci->tx_flush_timer,
+		    _rtl_pci_tx_flush_timer_callback, (unsigned long)hw);
+#endif
+
+	/*interrupt moderation */
+	rtlpci->irq_threaded = rtl_pci_threaded_irq;
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 13, 0)
+	hrtimer_setup(&rtlpci->irq_mod.holdoff_timer,
+		      _rtl_pci_irq_holdoff_callback,
+		      CLOCK_MONOTONIC, HRTIMER_MODE_REL);
+#else
+	hrtimer_init(&rtlpci->irq_mod.holdoff_timer,
+		     CLOCK_MONOTONIC, HRTIMER_MODE_REL);
+	rtlpci->irq_mod.holdoff_timer.function = _rtl_pci_irq_holdoff_callback;
+#endif
+
 	/*task */
 	tasklet_init(&rtlpriv->works.irq_tasklet,
 		     (void (*)(unsigned long))_rtl_pci_irq_tasklet,
@@ -1294,6 +1857,7 @@ static int _rtl_pci_init_tx_ring(struct ieee80211_hw *hw,
 
 	rtlpci->tx_ring[prio].idx = 0;
 	rtlpci->tx_ring[prio].entries = entries;
+	spin_lock_init(&rtlpci->tx_ring[prio].lock);
 	skb_queue_head_init(&rtlpci->tx_ring[prio].queue);
 
 	RT_TRACE(rtlpriv, COMP_INIT, DBG_LOUD, "queue:%d, ring_addr:%p\n",
@@ -1558,12 +2122,12 @@ int rtl_pci_reset_trx_ring(struct ieee80211_hw *hw)
 	 *after reset, release previous pending packet,
 	 *and force the  tx idx to the first one
 	 */
-	spin_lock_irqsave(&rtlpriv->locks.irq_th_lock, flags);
 	for (i = 0; i < RTL_PCI_MAX_TX_QUEUE_COUNT; i++) {
 		if (rtlpci->tx_ring[i].desc ||
 		    rtlpci->tx_ring[i].buffer_desc) {
 			struct rtl8192_tx_ring *ring = &rtlpci->tx_ring[i];
 
+			spin_lock_irqsave(&ring->lock, flags);
 			while (skb_queue_len(&ring->queue)) {
 				u8 *entry;
 				struct sk_buff *skb =
@@ -1585,9 +2149,10 @@ int rtl_pci_reset_trx_ring(struct ieee80211_hw *hw)
 				ring->idx = (ring->idx + 1) % ring->entries;
 			}
 			ring->idx = 0;
+			ring->tx_pending = 0;
+			spin_unlock_irqrestore(&ring->lock, flags);
 		}
 	}
-	spin_unlock_irqrestore(&rtlpriv->locks.irq_th_lock, flags);
 
 	return 0;
 }
@@ -1631,6 +2196,20 @@ static bool rtl_pci_tx_chk_waitq_insert(struct ieee80211_hw *hw,
 	return true;
 }
 
+/* True when mac80211 is about to hand us another frame right after
+ * this one, so the TX doorbell can wait for the rest of the burst.
+ */
+static bool _rtl_pci_tx_more(struct sk_buff *skb)
+{
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 2, 0)
+	return netdev_xmit_more();
+#elif LINUX_VERSION_CODE >= KERNEL_VERSION(3, 18, 0)
+	return skb->xmit_more;
+#else
+	return false;
+#endif
+}
+
 static int rtl_pci_tx(struct ieee80211_hw *hw,
 		      struct ieee80211_sta *sta,
 		      struct sk_buff *skb,
@@ -1654,6 +2233,9 @@ static int rtl_pci_tx(struct ieee80211_hw *hw,
 	u16 seq_number = 0;
 	u8 own;
 	u8 temp_one = 1;
+	bool stop = false;
+	bool defer;
+	bool kick;
 
 	if (ieee80211_is_mgmt(fc))
 		rtl_tx_mgmt_proc(hw, skb);
@@ -1667,14 +2249,14 @@ static int rtl_pci_tx(struct ieee80211_hw *hw,
 	rtl_action_proc(hw, skb, true);
 
 	if (is_multicast_ether_addr(pda_addr))
-		rtlpriv->stats.txbytesmulticast += skb->len;
+		rtl_data_stats_add(rtlpriv, tx_bytes_multicast, skb->len);
 	else if (is_broadcast_ether_addr(pda_addr))
-		rtlpriv->stats.txbytesbroadcast += skb->len;
+		rtl_data_stats_add(rtlpriv, tx_bytes_broadcast, skb->len);
 	else
-		rtlpriv->stats.txbytesunicast += skb->len;
+		rtl_data_stats_add(rtlpriv, tx_bytes_unicast, skb->len);
 
-	spin_lock_irqsave(&rtlpriv->locks.irq_th_lock, flags);
 	ring = &rtlpci->tx_ring[hw_queue];
+	spin_lock_irqsave(&ring->lock, flags);
 	if (hw_queue != BEACON_QUEUE) {
 		if (rtlpriv->use_new_trx_flow)
 			idx = ring->cur_tx_wp;
@@ -1698,8 +2280,7 @@ static int rtl_pci_tx(struct ieee80211_hw *hw,
 				 hw_queue, ring->idx, idx,
 				 skb_queue_len(&ring->queue));
 
-			spin_unlock_irqrestore(&rtlpriv->locks.irq_th_lock,
-					       flags);
+			spin_unlock_irqrestore(&ring->lock, flags);
 			return skb->len;
 		}
 	}
@@ -1708,8 +2289,7 @@ static int rtl_pci_tx(struct ieee80211_hw *hw,
 	    rtlpriv->cfg->ops->get_available_desc(hw, hw_queue) == 0) {
 			RT_TRACE(rtlpriv, COMP_ERR, DBG_WARNING,
 				 "get_available_desc fail\n");
-			spin_unlock_irqrestore(&rtlpriv->locks.irq_th_lock,
-					       flags);
+			spin_unlock_irqrestore(&ring->lock, flags);
 			return skb->len;
 	}
 
@@ -1731,6 +2311,7 @@ static int rtl_pci_tx(struct ieee80211_hw *hw,
 
 	rtlpriv->cfg->ops->fill_tx_desc(hw, hdr, (u8 *)pdesc,
 			(u8 *)ptx_bd_desc, info, sta, skb, hw_queue, ptcb_desc);
+	rtl_tx_report_prepare(hw, skb, ptcb_desc);
 
 	__skb_queue_tail(&ring->queue, skb);
 
@@ -1750,11 +2331,33 @@ static int rtl_pci_tx(struct ieee80211_hw *hw,
 			 skb_queue_len(&ring->queue));
 
 		ieee80211_stop_queue(hw, skb_get_queue_mapping(skb));
+		stop = true;
 	}
 
-	spin_unlock_irqrestore(&rtlpriv->locks.irq_th_lock, flags);
+	/* Data frames of a burst are published with a single doorbell.
+	 * With the new trx flow the write pointer update done by
+	 * set_desc() already is the doorbell, so nothing is deferred.
+	 */
+	ring->tx_pending++;
+	ring->batch_stats.frames++;
+	defer = !rtlpriv->use_new_trx_flow && hw_queue != BEACON_QUEUE &&
+		ieee80211_is_data(fc) && !stop &&
+		ring->tx_pending < rtlpci->tx_batch && _rtl_pci_tx_more(skb);
+	if (defer) {
+		kick = false;
+		if (!timer_pending(&rtlpci->tx_flush_timer))
+			mod_timer(&rtlpci->tx_flush_timer, jiffies + 1);
+	} else {
+		kick = _rtl_pci_tx_take_pending(ring);
+	}
+
+	spin_unlock_irqrestore(&ring->lock, flags);
 
-	rtlpriv->cfg->ops->tx_polling(hw, hw_queue);
+	if (kick) {
+		rtlpriv->cfg->ops->tx_polling(hw, hw_queue);
+		/* the burst may have left frames on other queues */
+		_rtl_pci_tx_kick_pending(hw, false);
+	}
 
 	return 0;
 }
@@ -1772,6 +2375,8 @@ static void rtl_pci_flush(struct ieee80211_hw *hw, u32 queues, bool drop)
 	if (mac->skip_scan)
 		return;
 
+	_rtl_pci_tx_kick_pending(hw, true);
+
 	for (queue_id = RTL_PCI_MAX_TX_QUEUE_COUNT - 1; queue_id >= 0;) {
 		u32 queue_len;
 
@@ -1805,6 +2410,8 @@ static void rtl_pci_deinit(struct ieee80211_hw *hw)
 	_rtl_pci_deinit_trx_ring(hw);
 
 	synchronize_irq(rtlpci->pdev->irq);
+	hrtimer_cancel(&rtlpci->irq_mod.holdoff_timer);
+	_rtl_pci_napi_deinit(hw);
 	tasklet_kill(&rtlpriv->works.irq_tasklet);
 	cancel_work_sync(&rtlpriv->works.lps_change_work);
 
@@ -1825,6 +2432,13 @@ static int rtl_pci_init(struct ieee80211_hw *hw, struct pci_dev *pdev)
 		return err;
 	}
 
+	err = _rtl_pci_napi_init(hw);
+	if (err) {
+		pr_err("NAPI initialization failed\n");
+		_rtl_pci_deinit_trx_ring(hw);
+		return err;
+	}
+
 	return 0;
 }
 
@@ -1856,6 +2470,12 @@ static int rtl_pci_start(struct ieee80211_hw *hw)
 	rtlpriv->cfg->ops->set_hw_reg(hw, HW_VAR_RETRY_LIMIT,
 			&rtlmac->retry_long);
 
+	/* hw_init() leaves interrupt migration off */
+	rtlpci->irq_mod.active = false;
+	rtlpci->irq_inta = 0;
+	rtlpci->irq_intb = 0;
+
+	_rtl_pci_napi_start(hw);
 	rtlpriv->cfg->ops->enable_interrupt(hw);
 	RT_TRACE(rtlpriv, COMP_INIT, DBG_LOUD, "enable_interrupt OK\n");
 
@@ -1891,7 +2511,10 @@ static void rtl_pci_stop(struct ieee80211_hw *hw)
 	set_hal_stop(rtlhal);
 
 	rtlpci->driver_is_goingto_unload = true;
+	_rtl_pci_napi_stop(hw);
 	rtlpriv->cfg->ops->disable_interrupt(hw);
+	del_timer_sync(&rtlpci->tx_flush_timer);
+	hrtimer_cancel(&rtlpci->irq_mod.holdoff_timer);
 	cancel_work_sync(&rtlpriv->works.lps_change_work);
 
 	spin_lock_irqsave(&rtlpriv->locks.rf_ps_lock, flags);
@@ -2120,6 +2743,20 @@ static bool _rtl_pci_find_adapter(struct pci_dev *pdev,
 	return true;
 }
 
+static int _rtl_pci_request_irq(struct ieee80211_hw *hw)
+{
+	struct rtl_pci *rtlpci = rtl_pcidev(rtl_pcipriv(hw));
+
+	if (rtlpci->irq_threaded)
+		return request_threaded_irq(rtlpci->pdev->irq,
+					    &_rtl_pci_interrupt,
+					    &_rtl_pci_interrupt_thread,
+					    IRQF_SHARED, KBUILD_MODNAME, hw);
+
+	return request_irq(rtlpci->pdev->irq, &_rtl_pci_interrupt,
+			   IRQF_SHARED, KBUILD_MODNAME, hw);
+}
+
 static int rtl_pci_intr_mode_msi(struct ieee80211_hw *hw)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
@@ -2131,8 +2768,7 @@ static int rtl_pci_intr_mode_msi(struct ieee80211_hw *hw)
 	if (ret < 0)
 		return ret;
 
-	ret = request_irq(rtlpci->pdev->irq, &_rtl_pci_interrupt,
-			  IRQF_SHARED, KBUILD_MODNAME, hw);
+	ret = _rtl_pci_request_irq(hw);
 	if (ret < 0) {
 		pci_disable_msi(rtlpci->pdev);
 		return ret;
@@ -2152,8 +2788,7 @@ static int rtl_pci_intr_mode_legacy(struct ieee80211_hw *hw)
 	struct rtl_pci *rtlpci = rtl_pcidev(pcipriv);
 	int ret;
 
-	ret = request_irq(rtlpci->pdev->irq, &_rtl_pci_interrupt,
-			  IRQF_SHARED, KBUILD_MODNAME, hw);
+	ret = _rtl_pci_request_irq(hw);
 	if (ret < 0)
 		return ret;
 
@@ -42,6 +42,13 @@
 #define RTL_PCI_MAX_RX_COUNT			512/*64*/
 #define RTL_PCI_MAX_TX_QUEUE_COUNT		9
 
+#define RTL_PCI_NAPI_WEIGHT			64
+
+/* upper limit for the txbatch module parameter */
+#define RTL_PCI_TX_BATCH_MAX			32
+
+#define RTL_PCI_IRQ_HIST_SIZE			8
+
 #define RT_TXDESC_NUM				128
 #define TX_DESC_NUM_92E				512
 #define RT_TXDESC_NUM_BE_QUEUE			256
@@ -172,7 +179,20 @@ struct rtl_tx_cmd_desc {
 	u32 dword[16];
 } __packed;
 
+struct rtl_pci_tx_batch_stats {
+	u64 frames;
+	u64 doorbells;
+	/* deferred doorbells rung by the flush timer or a queue flush */
+	u64 flushes;
+	u32 max_batch;
+	/* TX completion passes that freed descriptors, and how many */
+	u64 reclaims;
+	u64 reclaimed;
+};
+
 struct rtl8192_tx_ring {
+	/* protects the descriptors, queue and indexes of this ring */
+	spinlock_t lock;
 	struct rtl_tx_desc *desc;
 	dma_addr_t dma;
 	unsigned int idx;
@@ -184,6 +204,9 @@ struct rtl8192_tx_ring {
 	u16 avl_desc; /* available_desc_to_write */
 	u16 cur_tx_wp; /* current_tx_write_point */
 	u16 cur_tx_rp; /* current_tx_read_point */
+	/* descriptors handed to the hardware since the last doorbell */
+	u16 tx_pending;
+	struct rtl_pci_tx_batch_stats batch_stats;
 };
 
 struct rtl8192_rx_ring {
@@ -196,7 +219,38 @@ struct rtl8192_rx_ring {
 	u16 next_rx_rp; /* next_rx_read_point */
 };
 
+struct rtl_pci_napi_stats {
+	u64 polls;
+	/* polls that used their whole budget and were rescheduled */
+	u64 budget_exhausted;
+	u64 rx_frames;
+	u64 interrupts;
+	u32 irq_per_sec;
+	u32 irq_in_window;
+	unsigned long window_start;
+};
+
+struct rtl_pci_irq_mod {
+	/* moderation currently applied */
+	bool active;
+	/* software hold-off before the interrupt is unmasked again */
+	struct hrtimer holdoff_timer;
+
+	/* frames serviced since the last interrupt */
+	u32 frames;
+	u32 frames_in_window;
+	u32 frames_per_sec;
+	u64 holdoffs;
+	u64 switches;
+
+	/* seconds with fewer than 1000 << (n - 1) interrupts, n > 0 */
+	u64 rate_hist[RTL_PCI_IRQ_HIST_SIZE];
+	/* interrupts that serviced 2^(n - 1) to 2^n - 1 frames */
+	u64 frames_hist[RTL_PCI_IRQ_HIST_SIZE];
+};
+
 struct rtl_pci {
+	struct ieee80211_hw *hw;
 	struct pci_dev *pdev;
 	bool irq_enabled;
 
@@ -210,17 +264,30 @@ struct rtl_pci {
 	struct rtl8192_tx_ring tx_ring[RTL_PCI_MAX_TX_QUEUE_COUNT];
 	int txringcount[RTL_PCI_MAX_TX_QUEUE_COUNT];
 	u32 transmit_config;
+	/* max descriptors filled per TX doorbell, 1 means no batching */
+	u8 tx_batch;
+	struct timer_list tx_flush_timer;
 
 	/*Rx */
 	struct rtl8192_rx_ring rx_ring[RTL_PCI_MAX_RX_QUEUE];
 	int rxringcount;
 	u16 rxbuffersize;
 	u32 receive_config;
+	/* frames copied out of the RX ring, and frames lost for want of
+	 * memory for the copy
+	 */
+	u64 rx_copied;
+	u64 rx_copy_fails;
 
 	/*irq */
 	u8 irq_alloc;
 	u32 irq_mask[2];
 	u32 sys_irq_mask;
+	bool irq_threaded;
+	/* causes read by the hard IRQ, left for the IRQ thread */
+	u32 irq_inta;
+	u32 irq_intb;
+	struct rtl_pci_irq_mod irq_mod;
 
 	/*Bcn control register setting */
 	u32 reg_bcn_ctrl_val;
@@ -249,6 +316,14 @@ struct rtl_pci {
 	bool using_msi;
 	/* interrupt clear before set */
 	bool int_clear;
+
+	/* NAPI */
+	bool napi_support;
+	bool napi_enabled;
+	struct napi_struct napi;
+	struct net_device *napi_dev;
+	struct sk_buff_head napi_rx_list;
+	struct rtl_pci_napi_stats napi_stats;
 };
 
 struct mp_adapter {
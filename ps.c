@@ -27,8 +27,13 @@
 #include "base.h"
 #include "ps.h"
 #include <linux/export.h>
+#include <linux/moduleparam.h>
 #include "btcoexist/rtl_btc.h"
 
+static uint rtl_lps_latency_ms = 250;
+module_param_named(lps_latency_ms, rtl_lps_latency_ms, uint, 0644);
+MODULE_PARM_DESC(lps_latency_ms, "Latency target in ms above which traffic keeps the NIC out of LPS (default 250)\n");
+
 bool rtl_ps_enable_nic(struct ieee80211_hw *hw)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
@@ -294,6 +299,7 @@ void rtl_ips_nic_on(struct ieee80211_hw *hw)
 	cancel_delayed_work_sync(&rtlpriv->works.ips_nic_off_wq);
 
 	spin_lock(&rtlpriv->locks.ips_lock);
+	ppsc->pwrseq_atomic = true;
 	if (ppsc->inactiveps) {
 		rtstate = ppsc->rfpwr_state;
 
@@ -310,6 +316,7 @@ void rtl_ips_nic_on(struct ieee80211_hw *hw)
 									ppsc->inactive_pwrstate);
 		}
 	}
+	ppsc->pwrseq_atomic = false;
 	spin_unlock(&rtlpriv->locks.ips_lock);
 }
 EXPORT_SYMBOL_GPL(rtl_ips_nic_on);
@@ -486,11 +493,10 @@ static void rtl_lps_leave_core(struct ieee80211_hw *hw)
 }
 
 /* For sw LPS*/
-void rtl_swlps_beacon(struct ieee80211_hw *hw, void *data, unsigned int len)
+void rtl_swlps_beacon(struct ieee80211_hw *hw, struct rtl_rx_mgmt *rx_mgmt)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_mac *mac = rtl_mac(rtl_priv(hw));
-	struct ieee80211_hdr *hdr = data;
 	struct ieee80211_tim_ie *tim_ie;
 	u8 *tim;
 	u8 tim_len;
@@ -516,20 +522,17 @@ void rtl_swlps_beacon(struct ieee80211_hw *hw, void *data, unsigned int len)
 		return;
 
 	/* check if this really is a beacon */
-	if (!ieee80211_is_beacon(hdr->frame_control))
-		return;
-
-	/* min. beacon length + FCS_LEN */
-	if (len <= 40 + FCS_LEN)
+	if (!rx_mgmt->has_ies ||
+	    !ieee80211_is_beacon(rx_mgmt->hdr->frame_control))
 		return;
 
 	/* and only beacons from the associated BSSID, please */
-	if (!ether_addr_equal_64bits(hdr->addr3, rtlpriv->mac80211.bssid))
+	if (!rx_mgmt->from_bssid)
 		return;
 
 	rtlpriv->psc.last_beacon = jiffies;
 
-	tim = rtl_find_ie(data, len - FCS_LEN, WLAN_EID_TIM);
+	tim = rx_mgmt->tim;
 	if (!tim)
 		return;
 
@@ -704,6 +707,80 @@ void rtl_lps_leave(struct ieee80211_hw *hw)
 }
 EXPORT_SYMBOL_GPL(rtl_lps_leave);
 
+/* In LPS a frame may wait for the next wakeup, so LPS is left as soon
+ * as frames come in more often than once per latency target, and only
+ * entered again when the rate has settled below half of that.
+ */
+static void _rtl_ps_gov_limits(struct rtl_ps_gov *gov)
+{
+	u32 latency = max_t(u32, rtl_lps_latency_ms, 1);
+
+	gov->leave_pps = max_t(u32, 1000 / latency, 1);
+	gov->wake_pkts = DIV_ROUND_UP(gov->leave_pps * RTL_WATCH_DOG_TIME,
+				      1000);
+}
+
+static void _rtl_ps_gov_set(struct ieee80211_hw *hw, bool lps)
+{
+	struct rtl_ps_gov *gov = &rtl_priv(hw)->psc.gov;
+
+	if (gov->lps == lps)
+		return;
+
+	gov->lps = lps;
+	gov->since = jiffies;
+	if (lps)
+		gov->enters++;
+	else
+		gov->leaves++;
+}
+
+/* called from the watchdog with the updated traffic estimate */
+void rtl_ps_gov_update(struct ieee80211_hw *hw)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rt_link_detect *link = &rtlpriv->link_info;
+	struct rtl_ps_gov *gov = &rtlpriv->psc.gov;
+	u32 pps = link->tx_pps + link->rx_pps;
+
+	atomic_set(&gov->pkts, 0);
+	_rtl_ps_gov_limits(gov);
+
+	if (pps > gov->leave_pps ||
+	    link->num_rx_inperiod + link->num_tx_inperiod > gov->wake_pkts)
+		_rtl_ps_gov_set(hw, false);
+	else if (pps <= gov->leave_pps / 2)
+		_rtl_ps_gov_set(hw, true);
+
+	/* retried every period, entering may be refused for a while */
+	if (gov->lps)
+		rtl_lps_enter(hw);
+	else
+		rtl_lps_leave(hw);
+}
+EXPORT_SYMBOL_GPL(rtl_ps_gov_update);
+
+/* called from the TX/RX paths for each data frame, leaves LPS early on a
+ * burst instead of waiting for the watchdog. The frames are counted on
+ * their own, the per CPU counters are only summed up by the watchdog.
+ */
+void rtl_ps_gov_check(struct ieee80211_hw *hw)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_ps_gov *gov = &rtlpriv->psc.gov;
+
+	if (!gov->lps)
+		return;
+
+	if (atomic_inc_return(&gov->pkts) <= gov->wake_pkts)
+		return;
+
+	_rtl_ps_gov_set(hw, false);
+	gov->burst_leaves++;
+	rtl_lps_leave(hw);
+}
+EXPORT_SYMBOL_GPL(rtl_ps_gov_check);
+
 void rtl_swlps_wq_callback(void *data)
 {
 	struct rtl_works *rtlworks = container_of_dwork_rtl(data,
@@ -732,36 +809,20 @@ void rtl_swlps_wq_callback(void *data)
 	}
 }
 
-static void rtl_p2p_noa_ie(struct ieee80211_hw *hw, void *data,
-			   unsigned int len)
+static void rtl_p2p_noa_ie(struct ieee80211_hw *hw,
+			   struct rtl_rx_mgmt *rx_mgmt)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
-	struct ieee80211_mgmt *mgmt = data;
 	struct rtl_p2p_ps_info *p2pinfo = &(rtlpriv->psc.p2p_ps_info);
-	u8 *pos, *end, *ie;
+	u8 *end, *ie;
 	u16 noa_len;
-	static u8 p2p_oui_ie_type[4] = {0x50, 0x6f, 0x9a, 0x09};
 	u8 noa_num, index , i, noa_index = 0;
 	bool find_p2p_ie = false , find_p2p_ps_ie = false;
-	pos = (u8 *)mgmt->u.beacon.variable;
-	end = data + len;
-	ie = NULL;
+	end = (u8 *)rx_mgmt->hdr + rx_mgmt->len;
 
-	while (pos + 1 < end) {
-		if (pos + 2 + pos[1] > end)
-			return;
-
-		if (pos[0] == 221 && pos[1] > 4) {
-			if (memcmp(&pos[2], p2p_oui_ie_type, 4) == 0) {
-				ie = pos + 2+4;
-				break;
-			}
-		}
-		pos += 2 + pos[1];
-	}
-
-	if (ie == NULL)
+	if (!rx_mgmt->p2p)
 		return;
+	ie = rx_mgmt->p2p + 2 + 4;
 	find_p2p_ie = true;
 	/*to find noa ie*/
 	while (ie + 1 < end) {
@@ -993,33 +1054,25 @@ void rtl_p2p_ps_cmd(struct ieee80211_hw *hw , u8 p2p_ps_state)
 	RT_TRACE(rtlpriv, COMP_FW, DBG_LOUD, "end\n");
 }
 
-void rtl_p2p_info(struct ieee80211_hw *hw, void *data, unsigned int len)
+void rtl_p2p_info(struct ieee80211_hw *hw, struct rtl_rx_mgmt *rx_mgmt)
 {
-	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_mac *mac = rtl_mac(rtl_priv(hw));
-	struct ieee80211_hdr *hdr = data;
 
 	if (!mac->p2p)
 		return;
 	if (mac->link_state != MAC80211_LINKED)
 		return;
 	/* min. beacon length + FCS_LEN */
-	if (len <= 40 + FCS_LEN)
+	if (!rx_mgmt->has_ies)
 		return;
 
 	/* and only beacons from the associated BSSID, please */
-	if (!ether_addr_equal_64bits(hdr->addr3, rtlpriv->mac80211.bssid))
-		return;
-
-	/* check if this really is a beacon */
-	if (!(ieee80211_is_beacon(hdr->frame_control) ||
-	      ieee80211_is_probe_resp(hdr->frame_control) ||
-	      ieee80211_is_action(hdr->frame_control)))
+	if (!rx_mgmt->from_bssid)
 		return;
 
-	if (ieee80211_is_action(hdr->frame_control))
-		rtl_p2p_action_ie(hw , data , len - FCS_LEN);
-	else
-		rtl_p2p_noa_ie(hw , data , len - FCS_LEN);
+	if (ieee80211_is_action(rx_mgmt->hdr->frame_control))
+		rtl_p2p_action_ie(hw, rx_mgmt->hdr, rx_mgmt->len);
+	else if (rx_mgmt->bcn)
+		rtl_p2p_noa_ie(hw, rx_mgmt);
 }
 EXPORT_SYMBOL_GPL(rtl_p2p_info);
@@ -171,6 +171,226 @@ static void rtl_get_rate(void *ppriv, struct ieee80211_sta *sta,
 	}
 }
 
+/* The chips program a station's rate table under this mac_id in their
+ * update_rate_tbl, and the firmware reports against it.
+ */
+static u8 _rtl_rc_macid(struct rtl_priv *rtlpriv, struct ieee80211_sta *sta)
+{
+	struct rtl_mac *mac = rtl_mac(rtlpriv);
+
+	if (mac->opmode == NL80211_IFTYPE_AP ||
+	    mac->opmode == NL80211_IFTYPE_ADHOC)
+		return sta->aid + 1;
+	return 0;
+}
+
+/* channel width in MHz used towards sta, as _rtl_rc_rate_set_series()
+ * picks it
+ */
+static u8 _rtl_rc_bw(struct rtl_priv *rtlpriv, struct ieee80211_sta *sta)
+{
+	struct rtl_mac *mac = rtl_mac(rtlpriv);
+
+	if (mac->opmode == NL80211_IFTYPE_AP ||
+	    mac->opmode == NL80211_IFTYPE_ADHOC) {
+		if (sta->vht_cap.vht_supported)
+			return 80;
+		if (sta->ht_cap.cap & IEEE80211_HT_CAP_SUP_WIDTH_20_40)
+			return 40;
+		return 20;
+	}
+
+	if (mac->bw_80)
+		return 80;
+	if (mac->bw_40)
+		return 40;
+	return 20;
+}
+
+/* DESC_RATE1M to DESC_RATE54M, in 100 kbps */
+static const u16 rtl_rc_legacy_rates[] = {
+	10, 20, 55, 110, 60, 90, 120, 180, 240, 360, 480, 540
+};
+
+static bool _rtl_rc_rate_info(struct rtl_priv *rtlpriv,
+			      struct rtl_rate_priv *rate_priv,
+			      struct rate_info *rinfo)
+{
+	u8 rate = rate_priv->ra_rate;
+	u8 bw = _rtl_rc_bw(rtlpriv, rate_priv->sta);
+
+	memset(rinfo, 0, sizeof(*rinfo));
+	if (rate <= DESC_RATE54M) {
+		rinfo->legacy = rtl_rc_legacy_rates[rate];
+		return true;
+	}
+
+	if (rate >= DESC_RATEMCS0 && rate <= DESC_RATEMCS15) {
+		rinfo->flags = RATE_INFO_FLAGS_MCS;
+		rinfo->mcs = rate - DESC_RATEMCS0;
+		bw = min_t(u8, bw, 40);
+	} else if (rate >= DESC_RATEVHT1SS_MCS0 &&
+		   rate <= DESC_RATEVHT2SS_MCS9) {
+		rinfo->flags = RATE_INFO_FLAGS_VHT_MCS;
+		rinfo->mcs = (rate - DESC_RATEVHT1SS_MCS0) % 10;
+		rinfo->nss = (rate - DESC_RATEVHT1SS_MCS0) / 10 + 1;
+	} else {
+		return false;
+	}
+
+	if (rate_priv->ra_sgi)
+		rinfo->flags |= RATE_INFO_FLAGS_SHORT_GI;
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(4, 0, 0)
+	if (bw == 80)
+		rinfo->bw = RATE_INFO_BW_80;
+	else if (bw == 40)
+		rinfo->bw = RATE_INFO_BW_40;
+	else
+		rinfo->bw = RATE_INFO_BW_20;
+#else
+	if (bw == 80)
+		rinfo->flags |= RATE_INFO_FLAGS_80_MHZ_WIDTH;
+	else if (bw == 40)
+		rinfo->flags |= RATE_INFO_FLAGS_40_MHZ_WIDTH;
+#endif
+	return true;
+}
+
+/* The expected throughput is the PHY rate of the last report less the
+ * averaged error rate. Called with the rc lock held.
+ */
+static void _rtl_rc_update_estimate(struct rtl_priv *rtlpriv,
+				    struct rtl_rate_priv *rate_priv)
+{
+	struct rate_info rinfo;
+
+	if (!rate_priv->ra_valid ||
+	    !_rtl_rc_rate_info(rtlpriv, rate_priv, &rinfo))
+		return;
+
+	rate_priv->cur_bitrate = cfg80211_calculate_bitrate(&rinfo) * 100;
+	rate_priv->tput = ((u64)rate_priv->cur_bitrate *
+			   (1024 - rate_priv->per)) >> 10;
+}
+
+void rtl_rc_init(struct ieee80211_hw *hw)
+{
+	struct rtl_rc *rc = &rtl_priv(hw)->rc;
+
+	spin_lock_init(&rc->lock);
+	memset(rc->sta, 0, sizeof(rc->sta));
+	rc->fixed_rate = -1;
+	rc->max_rate = -1;
+}
+EXPORT_SYMBOL_GPL(rtl_rc_init);
+
+/* Rate adaptation report of the firmware: the rate it now uses for
+ * mac_id, as a DESC_RATE* code.
+ */
+void rtl_rc_ra_report(struct ieee80211_hw *hw, u8 mac_id, u8 hw_rate,
+		      bool sgi)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_rc *rc = &rtlpriv->rc;
+	struct rtl_rate_priv *rate_priv;
+	unsigned long flags;
+
+	RT_TRACE(rtlpriv, COMP_RATE, DBG_LOUD,
+		 "RA report: mac_id %d rate %#x sgi %d\n", mac_id, hw_rate,
+		 sgi);
+
+	if (mac_id >= RTL_RC_MACID_NUM)
+		return;
+
+	spin_lock_irqsave(&rc->lock, flags);
+	rate_priv = rc->sta[mac_id];
+	if (rate_priv) {
+		if (!rate_priv->ra_valid || rate_priv->ra_rate != hw_rate ||
+		    rate_priv->ra_sgi != sgi)
+			rate_priv->ra_changes++;
+		rate_priv->ra_valid = true;
+		rate_priv->ra_rate = hw_rate;
+		rate_priv->ra_sgi = sgi;
+		rate_priv->ra_time = jiffies;
+		rate_priv->ra_reports++;
+		_rtl_rc_update_estimate(rtlpriv, rate_priv);
+	}
+	spin_unlock_irqrestore(&rc->lock, flags);
+}
+EXPORT_SYMBOL_GPL(rtl_rc_ra_report);
+
+/* TX rate of sta as last reported by the firmware */
+bool rtl_rc_get_txrate(struct ieee80211_hw *hw, struct ieee80211_sta *sta,
+		       struct rate_info *rinfo)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_rc *rc = &rtlpriv->rc;
+	struct rtl_rate_priv *rate_priv;
+	unsigned long flags;
+	bool ret = false;
+	u8 mac_id = _rtl_rc_macid(rtlpriv, sta);
+
+	if (mac_id >= RTL_RC_MACID_NUM)
+		return false;
+
+	spin_lock_irqsave(&rc->lock, flags);
+	rate_priv = rc->sta[mac_id];
+	if (rate_priv && rate_priv->sta == sta && rate_priv->ra_valid)
+		ret = _rtl_rc_rate_info(rtlpriv, rate_priv, rinfo);
+	spin_unlock_irqrestore(&rc->lock, flags);
+
+	return ret;
+}
+EXPORT_SYMBOL_GPL(rtl_rc_get_txrate);
+
+/* Applies the debugfs overrides to unicast data the firmware would rate:
+ * fixed_rate pins it, max_rate starts it there and lets the hardware fall
+ * back along the station's rate table.
+ */
+void rtl_rc_tx_override(struct ieee80211_hw *hw, struct ieee80211_sta *sta,
+			struct rtl_tcb_desc *tcb_desc)
+{
+	struct rtl_rc *rc = &rtl_priv(hw)->rc;
+	int fixed_rate = READ_ONCE(rc->fixed_rate);
+	int max_rate = READ_ONCE(rc->max_rate);
+
+	if (!sta || tcb_desc->use_driver_rate || tcb_desc->multicast ||
+	    tcb_desc->broadcast)
+		return;
+
+	if (fixed_rate >= 0) {
+		tcb_desc->hw_rate = fixed_rate;
+		tcb_desc->use_driver_rate = true;
+		tcb_desc->disable_ratefallback = 1;
+	} else if (max_rate >= 0) {
+		tcb_desc->hw_rate = min_t(u8, tcb_desc->hw_rate, max_rate);
+		tcb_desc->use_driver_rate = true;
+		tcb_desc->disable_ratefallback = 0;
+	}
+}
+EXPORT_SYMBOL_GPL(rtl_rc_tx_override);
+
+static void _rtl_rc_tx_status(struct rtl_priv *rtlpriv,
+			      struct rtl_rate_priv *rate_priv,
+			      struct sk_buff *skb)
+{
+	struct ieee80211_tx_info *info = IEEE80211_SKB_CB(skb);
+	bool acked = !!(info->flags & IEEE80211_TX_STAT_ACK);
+	u32 attempts = max_t(int, info->status.rates[0].count, 1);
+	u32 sample = (attempts - acked) * 1024 / attempts;
+	unsigned long flags;
+
+	spin_lock_irqsave(&rtlpriv->rc.lock, flags);
+	rate_priv->tx_frames++;
+	rate_priv->tx_acked += acked;
+	rate_priv->tx_attempts += attempts;
+	rate_priv->per = rate_priv->per -
+			 (rate_priv->per >> RTL_RC_PER_EWMA_SHIFT) +
+			 (sample >> RTL_RC_PER_EWMA_SHIFT);
+	_rtl_rc_update_estimate(rtlpriv, rate_priv);
+	spin_unlock_irqrestore(&rtlpriv->rc.lock, flags);
+}
+
 static bool _rtl_tx_aggr_check(struct rtl_priv *rtlpriv,
 			       struct rtl_sta_info *sta_entry, u16 tid)
 {
@@ -211,6 +431,8 @@ static void rtl_tx_status(void *ppriv,
 	    is_broadcast_ether_addr(ieee80211_get_DA(hdr)))
 		return;
 
+	_rtl_rc_tx_status(rtlpriv, priv_sta, skb);
+
 	if (sta) {
 		/* Check if aggregation has to be enabled for this tid */
 		sta_entry = (struct rtl_sta_info *) sta->drv_priv;
@@ -235,6 +457,23 @@ static void rtl_rate_init(void *ppriv,
 			  struct cfg80211_chan_def *chandef,
 			  struct ieee80211_sta *sta, void *priv_sta)
 {
+	struct rtl_priv *rtlpriv = ppriv;
+	struct rtl_rc *rc = &rtlpriv->rc;
+	struct rtl_rate_priv *rate_priv = priv_sta;
+	unsigned long flags;
+
+	rate_priv->sta = sta;
+	rate_priv->mac_id = _rtl_rc_macid(rtlpriv, sta);
+	if (rate_priv->mac_id >= RTL_RC_MACID_NUM)
+		return;
+
+	/* a station that left without free_sta yet loses its slot */
+	spin_lock_irqsave(&rc->lock, flags);
+	if (rc->sta[rate_priv->mac_id])
+		rc->sta[rate_priv->mac_id]->registered = false;
+	rc->sta[rate_priv->mac_id] = rate_priv;
+	rate_priv->registered = true;
+	spin_unlock_irqrestore(&rc->lock, flags);
 }
 
 static void rtl_rate_update(void *ppriv,
@@ -243,7 +482,24 @@ static void rtl_rate_update(void *ppriv,
 			    struct ieee80211_sta *sta, void *priv_sta,
 			    u32 changed)
 {
+	struct rtl_priv *rtlpriv = ppriv;
+	struct rtl_rate_priv *rate_priv = priv_sta;
+	unsigned long flags;
+
+	/* the width may have changed */
+	spin_lock_irqsave(&rtlpriv->rc.lock, flags);
+	_rtl_rc_update_estimate(rtlpriv, rate_priv);
+	spin_unlock_irqrestore(&rtlpriv->rc.lock, flags);
+}
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(3, 16, 0)
+static u32 rtl_rate_get_expected_throughput(void *priv_sta)
+{
+	struct rtl_rate_priv *rate_priv = priv_sta;
+
+	return rate_priv->tput;
 }
+#endif
 
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 7, 0)
 static void *rtl_rate_alloc(struct ieee80211_hw *hw)
@@ -277,10 +533,20 @@ static void *rtl_rate_alloc_sta(void *ppriv,
 	return rate_priv;
 }
 
-static void rtl_rate_free_sta(void *rtlpriv,
+static void rtl_rate_free_sta(void *ppriv,
 			      struct ieee80211_sta *sta, void *priv_sta)
 {
+	struct rtl_priv *rtlpriv = ppriv;
 	struct rtl_rate_priv *rate_priv = priv_sta;
+	unsigned long flags;
+
+	spin_lock_irqsave(&rtlpriv->rc.lock, flags);
+	if (rate_priv->registered)
+		rtlpriv->rc.sta[rate_priv->mac_id] = NULL;
+	spin_unlock_irqrestore(&rtlpriv->rc.lock, flags);
+
+	if (rtlpriv->rate_priv == rate_priv)
+		rtlpriv->rate_priv = NULL;
 	kfree(rate_priv);
 }
 
@@ -294,6 +560,9 @@ static struct rate_control_ops rtl_rate_ops = {
 	.rate_update = rtl_rate_update,
 	.tx_status = rtl_tx_status,
 	.get_rate = rtl_get_rate,
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(3, 16, 0)
+	.get_expected_throughput = rtl_rate_get_expected_throughput,
+#endif
 };
 
 int rtl_rate_control_register(void)
@@ -38,11 +38,45 @@
 #define AC_MODE_MCS8_RIX 8
 #define AC_MODE_MCS9_RIX 9
 
+/* weight of a new sample in the error rate average, 1/2^n */
+#define RTL_RC_PER_EWMA_SHIFT	3
+
 struct rtl_rate_priv {
 	u8 ht_cap;
+
+	struct ieee80211_sta *sta;
+	u8 mac_id;
+	bool registered;
+
+	/* last rate adaptation report of the firmware, DESC_RATE* */
+	bool ra_valid;
+	u8 ra_rate;
+	bool ra_sgi;
+	unsigned long ra_time;
+	u64 ra_reports;
+	u64 ra_changes;
+
+	/* unicast data TX status; with firmware TX reports these carry
+	 * the real outcome, otherwise every frame looks acked
+	 */
+	u64 tx_frames;
+	u64 tx_acked;
+	u64 tx_attempts;
+	/* failed attempts per attempt, in 1/1024, averaged */
+	u32 per;
+	/* in kbps */
+	u32 cur_bitrate;
+	u32 tput;
 };
 
 int rtl_rate_control_register(void);
 void rtl_rate_control_unregister(void);
+void rtl_rc_init(struct ieee80211_hw *hw);
+void rtl_rc_ra_report(struct ieee80211_hw *hw, u8 mac_id, u8 hw_rate,
+		      bool sgi);
+bool rtl_rc_get_txrate(struct ieee80211_hw *hw, struct ieee80211_sta *sta,
+		       struct rate_info *rinfo);
+void rtl_rc_tx_override(struct ieee80211_hw *hw, struct ieee80211_sta *sta,
+			struct rtl_tcb_desc *tcb_desc);
 
 #endif
@@ -92,7 +92,7 @@ static void _rtl88ee_return_beacon_queue_skb(struct ieee80211_hw *hw)
 	struct rtl8192_tx_ring *ring = &rtlpci->tx_ring[BEACON_QUEUE];
 	unsigned long flags;
 
-	spin_lock_irqsave(&rtlpriv->locks.irq_th_lock, flags);
+	spin_lock_irqsave(&ring->lock, flags);
 	while (skb_queue_len(&ring->queue)) {
 		struct rtl_tx_desc *entry = &ring->desc[ring->idx];
 		struct sk_buff *skb = __skb_dequeue(&ring->queue);
@@ -104,7 +104,7 @@ static void _rtl88ee_return_beacon_queue_skb(struct ieee80211_hw *hw)
 		kfree_skb(skb);
 		ring->idx = (ring->idx + 1) % ring->entries;
 	}
-	spin_unlock_irqrestore(&rtlpriv->locks.irq_th_lock, flags);
+	spin_unlock_irqrestore(&ring->lock, flags);
 }
 
 static void _rtl88ee_disable_bcn_sub_func(struct ieee80211_hw *hw)
@@ -745,6 +745,18 @@ void rtl88ee_set_hw_reg(struct ieee80211_hw *hw, u8 variable, u8 *val)
 		rtl88e_fill_h2c_cmd(hw, H2C_88E_KEEP_ALIVE_CTRL,
 				    2, array);
 		break; }
+	case HW_VAR_INT_MIGRATION: {
+		bool int_migration = *((bool *)val);
+
+		/* timer 25ns*0xfa0=100us for 0xf packets.
+		 * 0x306:Rx, 0x307:Tx
+		 */
+		if (int_migration)
+			rtl_write_dword(rtlpriv, REG_INT_MIG, 0xfe000fa0);
+		else
+			rtl_write_dword(rtlpriv, REG_INT_MIG, 0);
+		rtlpriv->dm.interrupt_migration = int_migration;
+		break; }
 	default:
 		pr_err("switch case %#x not processed\n", variable);
 		break;
@@ -26,6 +26,7 @@
 #include "../wifi.h"
 #include "../pci.h"
 #include "../ps.h"
+#include "../core.h"
 #include "reg.h"
 #include "def.h"
 #include "phy.h"
@@ -1963,6 +1964,7 @@ void rtl88e_phy_iq_calibrate(struct ieee80211_hw *hw, bool b_recovery)
 	long reg_e94, reg_e9c, reg_ea4, reg_eac, reg_eb4, reg_ebc, reg_ec4,
 	    reg_ecc, reg_tmp = 0;
 	bool is12simular, is13simular, is23simular;
+	u64 start;
 	u32 iqk_bb_reg[9] = {
 		ROFDM0_XARXIQIMBALANCE,
 		ROFDM0_XBRXIQIMBALANCE,
@@ -1974,6 +1976,11 @@ void rtl88e_phy_iq_calibrate(struct ieee80211_hw *hw, bool b_recovery)
 		ROFDM0_XDTXAFE,
 		ROFDM0_RXIQEXTANTA
 	};
+	u32 iqk_rx_reg[3] = {
+		ROFDM0_XARXIQIMBALANCE,
+		ROFDM0_XBRXIQIMBALANCE,
+		ROFDM0_RXIQEXTANTA
+	};
 
 	if (b_recovery) {
 		_rtl88e_phy_reload_adda_registers(hw,
@@ -1982,6 +1989,19 @@ void rtl88e_phy_iq_calibrate(struct ieee80211_hw *hw, bool b_recovery)
 		return;
 	}
 
+	if (rtl_iqk_cache_reload(hw, iqk_rx_reg, 3, result[0])) {
+		if (result[0][0] != 0)
+			_rtl88e_phy_path_a_fill_iqk_matrix(hw, true, result, 0,
+							   (result[0][2] == 0));
+		for (i = 0; i < IQK_MATRIX_REG_NUM; i++)
+			rtlphy->iqk_matrix[0].value[0][i] = result[0][i];
+		rtlphy->iqk_matrix[0].iqk_done = true;
+		_rtl88e_phy_save_adda_registers(hw, iqk_bb_reg,
+						rtlphy->iqk_bb_backup, 9);
+		return;
+	}
+	start = ktime_get_ns();
+
 	for (i = 0; i < 8; i++) {
 		result[0][i] = 0;
 		result[1][i] = 0;
@@ -2073,6 +2093,9 @@ void rtl88e_phy_iq_calibrate(struct ieee80211_hw *hw, bool b_recovery)
 	}
 	_rtl88e_phy_save_adda_registers(hw, iqk_bb_reg,
 					rtlphy->iqk_bb_backup, 9);
+	if (final_candidate < 4)
+		rtl_iqk_cache_save(hw, iqk_rx_reg, 3, result[final_candidate],
+				   start);
 }
 
 void rtl88e_phy_lc_calibrate(struct ieee80211_hw *hw)
@@ -295,6 +295,7 @@ static const struct rtl_hal_cfg rtl88ee_hal_cfg = {
 	.name = "rtl88e_pci",
 	.ops = &rtl8188ee_hal_ops,
 	.mod_params = &rtl88ee_mod_params,
+	.hw_int_migration = true,
 
 	.maps[SYS_ISO_CTRL] = REG_SYS_ISO_CTRL,
 	.maps[SYS_FUNC_EN] = REG_SYS_FUNC_EN,
@@ -552,6 +552,18 @@ void rtl92ce_set_hw_reg(struct ieee80211_hw *hw, u8 variable, u8 *val)
 		array[1] = *((u8 *)val);
 		rtl92c_fill_h2c_cmd(hw, H2C_92C_KEEP_ALIVE_CTRL, 2, array);
 		break; }
+	case HW_VAR_INT_MIGRATION: {
+		bool int_migration = *((bool *)val);
+
+		/* timer 25ns*0xfa0=100us for 0xf packets.
+		 * 0x306:Rx, 0x307:Tx
+		 */
+		if (int_migration)
+			rtl_write_dword(rtlpriv, REG_INT_MIG, 0xfe000fa0);
+		else
+			rtl_write_dword(rtlpriv, REG_INT_MIG, 0);
+		rtlpriv->dm.interrupt_migration = int_migration;
+		break; }
 	default:
 		pr_err("switch case %d not processed\n", variable);
 		break;
@@ -263,6 +263,7 @@ static const struct rtl_hal_cfg rtl92ce_hal_cfg = {
 	.name = "rtl92c_pci",
 	.ops = &rtl8192ce_hal_ops,
 	.mod_params = &rtl92ce_mod_params,
+	.hw_int_migration = true,
 
 	.maps[SYS_ISO_CTRL] = REG_SYS_ISO_CTRL,
 	.maps[SYS_FUNC_EN] = REG_SYS_FUNC_EN,
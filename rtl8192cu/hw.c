@@ -784,6 +784,39 @@ static void _rtl92cu_init_queue_priority(struct ieee80211_hw *hw,
 
 static void _rtl92cu_init_usb_aggregation(struct ieee80211_hw *hw)
 {
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+	int pages = clamp(rtlpriv->cfg->mod_params->usb_rx_agg, 0,
+			  RTL_USB_RX_AGG_PAGE_MAX);
+	u32 value32;
+	u8 value_dma, value_usb;
+
+	/* Tx aggregation: descriptors per bulk-OUT transfer */
+	value32 = rtl_read_dword(rtlpriv, REG_TDECTRL);
+	value32 &= ~(BLK_DESC_NUM_MASK << BLK_DESC_NUM_SHIFT);
+	value32 |= (rtlusb->tx_agg_num & BLK_DESC_NUM_MASK) <<
+		   BLK_DESC_NUM_SHIFT;
+	rtl_write_dword(rtlpriv, REG_TDECTRL, value32);
+
+	/* Rx aggregation in DMA mode: a bulk-IN is closed once it holds
+	 * this many pages or the timeout expires.
+	 */
+	value_dma = rtl_read_byte(rtlpriv, REG_TRXDMA_CTRL);
+	value_usb = rtl_read_byte(rtlpriv, REG_USB_SPECIAL_OPTION);
+	value_usb &= ~USB_AGG_EN;
+	if (pages)
+		value_dma |= RXDMA_AGG_EN;
+	else
+		value_dma &= ~RXDMA_AGG_EN;
+	rtl_write_byte(rtlpriv, REG_TRXDMA_CTRL, value_dma);
+	rtl_write_byte(rtlpriv, REG_USB_SPECIAL_OPTION, value_usb);
+	if (pages) {
+		rtl_write_byte(rtlpriv, REG_RXDMA_AGG_PG_TH, pages);
+		rtl_write_byte(rtlpriv, REG_RXDMA_AGG_PG_TH + 1,
+			       RTL_USB_RX_AGG_PAGE_TIMEOUT);
+	}
+	RT_TRACE(rtlpriv, COMP_INIT, DBG_DMESG,
+		 "USB RX aggregation: %d pages\n", pages);
 }
 
 static void _rtl92cu_init_wmac_setting(struct ieee80211_hw *hw)
@@ -28,3 +28,7 @@
  *****************************************************************************/
 
 #include "../rtl8192ce/reg.h"
+
+/* REG_TDECTRL */
+#define BLK_DESC_NUM_SHIFT			4
+#define BLK_DESC_NUM_MASK			0xF
@@ -166,12 +166,15 @@ static struct rtl_hal_ops rtl8192cu_hal_ops = {
 static struct rtl_mod_params rtl92cu_mod_params = {
 	.sw_crypto = 0,
 	.debug = 0,
+	.usb_rx_agg = RTL_USB_RX_AGG_PAGE_NUM,
 };
 
 module_param_named(swenc, rtl92cu_mod_params.sw_crypto, bool, 0444);
 module_param_named(debug, rtl92cu_mod_params.debug, int, 0444);
+module_param_named(rxagg, rtl92cu_mod_params.usb_rx_agg, int, 0444);
 MODULE_PARM_DESC(swenc, "Set to 1 for software crypto (default 0)\n");
 MODULE_PARM_DESC(debug, "Set debug level (0-5) (default 0)");
+MODULE_PARM_DESC(rxagg, "USB RX aggregation threshold in 128-byte pages, 0 to disable (default 48)\n");
 
 static struct rtl_hal_usbint_cfg rtl92cu_interface_cfg = {
 	/* rx */
@@ -179,11 +182,13 @@ static struct rtl_hal_usbint_cfg rtl92cu_interface_cfg = {
 	.rx_urb_num = RTL92C_NUM_RX_URBS,
 	.rx_max_size = RTL92C_SIZE_MAX_RX_BUFFER,
 	.usb_rx_hdl = rtl8192cu_rx_hdl,
-	.usb_rx_segregate_hdl = NULL, /* rtl8192c_rx_segregate_hdl; */
+	.usb_rx_segregate_hdl = rtl8192c_rx_segregate_hdl,
 	/* tx */
 	.usb_tx_cleanup = rtl8192c_tx_cleanup,
 	.usb_tx_post_hdl = rtl8192c_tx_post_hdl,
 	.usb_tx_aggregate_hdl = rtl8192c_tx_aggregate_hdl,
+	.tx_agg_num = RTL_USB_TX_AGG_NUM_DESC,
+	.tx_agg_size = RTL92C_SIZE_MAX_TX_AGG,
 	/* endpoint mapping */
 	.usb_endpoint_mapping = rtl8192cu_endpoint_mapping,
 	.usb_mq_to_hwq = rtl8192cu_mq_to_hwq,
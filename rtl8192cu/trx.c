@@ -440,11 +440,50 @@ void  rtl8192cu_rx_hdl(struct ieee80211_hw *hw, struct sk_buff * skb)
 	_rtl_rx_process(hw, skb);
 }
 
+/**
+ *	Splits an aggregated bulk-IN transfer into one skb per frame. Every
+ *	frame keeps its rx descriptor. The frames share the transfer's
+ *	buffer through clones, the last one gets the skb itself.
+ */
 void rtl8192c_rx_segregate_hdl(
 	struct ieee80211_hw *hw,
 	struct sk_buff *skb,
 	struct sk_buff_head *skb_list)
 {
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct sk_buff *frame;
+	u8 *rxdesc;
+	u32 hdr_off, frame_len, next;
+
+	/* every frame is copied into an skb of its own size, so that none
+	 * is charged for the whole bulk IN buffer
+	 */
+	while (skb->len >= RTL_RX_DESC_SIZE) {
+		rxdesc = skb->data;
+		hdr_off = RTL_RX_DESC_SIZE +
+			  GET_RX_DESC_DRVINFO_SIZE(rxdesc) *
+			  RTL_RX_DRV_INFO_UNIT +
+			  GET_RX_DESC_SHIFT(rxdesc);
+		frame_len = hdr_off + GET_RX_DESC_PKT_LEN(rxdesc);
+		if (!GET_RX_DESC_PKT_LEN(rxdesc) || frame_len > skb->len) {
+			RT_TRACE(rtlpriv, COMP_RECV, DBG_WARNING,
+				 "bad rx frame length %d of %d\n",
+				 frame_len, skb->len);
+			break;
+		}
+
+		frame = rtl_usb_rx_copy_frame(hw, rxdesc, frame_len, hdr_off);
+		if (!frame)
+			break;
+		__skb_queue_tail(skb_list, frame);
+
+		next = ALIGN(frame_len, RTL_USB_RX_AGG_ALIGN);
+		if (next >= skb->len)
+			break;
+		skb_pull(skb, next);
+	}
+
+	dev_kfree_skb_any(skb);
 }
 
 /*----------------------------------------------------------------------
@@ -462,12 +501,6 @@ int rtl8192c_tx_post_hdl(struct ieee80211_hw *hw, struct urb *urb,
 	return 0;
 }
 
-struct sk_buff *rtl8192c_tx_aggregate_hdl(struct ieee80211_hw *hw,
-					   struct sk_buff_head *list)
-{
-	return skb_dequeue(list);
-}
-
 /*======================================== trx ===============================*/
 
 static void _rtl_fill_usb_tx_desc(u8 *txdesc)
@@ -492,6 +525,19 @@ static void _rtl_tx_desc_checksum(u8 *txdesc)
 	SET_TX_DESC_TX_DESC_CHECKSUM(txdesc, checksum);
 }
 
+/**
+ *	The first descriptor of a bulk-OUT tells the chip how many frames
+ *	are packed behind it.
+ */
+void rtl8192c_tx_aggregate_hdl(struct ieee80211_hw *hw, struct sk_buff *agg,
+			       u8 agg_num)
+{
+	u8 *txdesc = agg->data;
+
+	SET_TX_DESC_USB_TXAGG_NUM(txdesc, agg_num);
+	_rtl_tx_desc_checksum(txdesc);
+}
+
 void rtl92cu_tx_fill_desc(struct ieee80211_hw *hw,
 			  struct ieee80211_hdr *hdr, u8 *pdesc_tx,
 			  u8 *pbd_desc_tx, struct ieee80211_tx_info *info,
@@ -35,6 +35,7 @@
 #define RTL92C_NUM_TX_URBS			32
 
 #define RTL92C_SIZE_MAX_RX_BUFFER		15360   /* 8192 */
+#define RTL92C_SIZE_MAX_TX_AGG			20480
 #define RX_DRV_INFO_SIZE_UNIT			8
 
 #define RTL_AGG_ON				1
@@ -52,8 +53,12 @@ enum usb_rx_agg_mode {
 
 #define RTL_USB_TX_AGG_NUM_DESC			5
 
-#define RTL_USB_RX_AGG_PAGE_NUM			4
-#define RTL_USB_RX_AGG_PAGE_TIMEOUT		3
+#define RTL_USB_RX_AGG_PAGE_NUM			48
+#define RTL_USB_RX_AGG_PAGE_TIMEOUT		4
+/* keeps room in the rx buffer for one more max-size frame */
+#define RTL_USB_RX_AGG_PAGE_MAX			48
+/* frames in an aggregated bulk-IN start on this boundary */
+#define RTL_USB_RX_AGG_ALIGN			128
 
 #define RTL_USB_RX_AGG_BLOCK_NUM		5
 #define RTL_USB_RX_AGG_BLOCK_TIMEOUT		3
@@ -416,8 +421,8 @@ void rtl8192c_rx_segregate_hdl(struct ieee80211_hw *, struct sk_buff *,
 void rtl8192c_tx_cleanup(struct ieee80211_hw *hw, struct sk_buff  *skb);
 int rtl8192c_tx_post_hdl(struct ieee80211_hw *hw, struct urb *urb,
 			 struct sk_buff *skb);
-struct sk_buff *rtl8192c_tx_aggregate_hdl(struct ieee80211_hw *,
-					   struct sk_buff_head *);
+void rtl8192c_tx_aggregate_hdl(struct ieee80211_hw *hw, struct sk_buff *agg,
+			       u8 agg_num);
 void rtl92cu_tx_fill_desc(struct ieee80211_hw *hw,
 			  struct ieee80211_hdr *hdr, u8 *pdesc_tx,
 			  u8 *pbd_desc_tx, struct ieee80211_tx_info *info,
@@ -268,6 +268,7 @@ static const struct rtl_hal_cfg rtl92de_hal_cfg = {
 	.name = "rtl8192de",
 	.ops = &rtl8192de_hal_ops,
 	.mod_params = &rtl92de_mod_params,
+	.hw_int_migration = true,
 
 	.maps[SYS_ISO_CTRL] = REG_SYS_ISO_CTRL,
 	.maps[SYS_FUNC_EN] = REG_SYS_FUNC_EN,
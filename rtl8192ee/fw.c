@@ -27,6 +27,7 @@
 #include "../pci.h"
 #include "../base.h"
 #include "../core.h"
+#include "../rc.h"
 #include "reg.h"
 #include "def.h"
 #include "fw.h"
@@ -944,6 +945,7 @@ static void _rtl92ee_c2h_ra_report_handler(struct ieee80211_hw *hw,
 	u8 rate = cmd_buf[0] & 0x3F;
 	bool collision_state = cmd_buf[3] & BIT(0);
 
+	rtl_rc_ra_report(hw, cmd_buf[1], rate, cmd_buf[0] & BIT(7));
 	rtl92ee_dm_dynamic_arfb_select(hw, rate, collision_state);
 }
 
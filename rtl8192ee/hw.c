@@ -686,6 +686,18 @@ void rtl92ee_set_hw_reg(struct ieee80211_hw *hw, u8 variable, u8 *val)
 		rtl92ee_fill_h2c_cmd(hw, H2C_92E_KEEP_ALIVE_CTRL, 2, array);
 		}
 		break;
+	case HW_VAR_INT_MIGRATION: {
+		bool int_migration = *((bool *)val);
+
+		/* timer 25ns*0xfa0=100us for 0xf packets.
+		 * 0x306:Rx, 0x307:Tx
+		 */
+		if (int_migration)
+			rtl_write_dword(rtlpriv, REG_INT_MIG, 0xfe000fa0);
+		else
+			rtl_write_dword(rtlpriv, REG_INT_MIG, 0);
+		rtlpriv->dm.interrupt_migration = int_migration;
+		break; }
 	default:
 		RT_TRACE(rtlpriv, COMP_ERR, DBG_DMESG,
 			 "switch case %#x not processed\n", variable);
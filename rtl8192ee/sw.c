@@ -268,6 +268,8 @@ static const struct rtl_hal_cfg rtl92ee_hal_cfg = {
 	.name = "rtl92ee_pci",
 	.ops = &rtl8192ee_hal_ops,
 	.mod_params = &rtl92ee_mod_params,
+	.tx_status_report = true,
+	.hw_int_migration = true,
 
 	.maps[SYS_ISO_CTRL] = REG_SYS_ISO_CTRL,
 	.maps[SYS_FUNC_EN] = REG_SYS_FUNC_EN,
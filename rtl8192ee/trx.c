@@ -565,6 +565,9 @@ u16 rtl92ee_get_available_desc(struct ieee80211_hw *hw, u8 q_idx)
 	point_diff = calc_fifo_space(current_tx_read_point,
 				     current_tx_write_point);
 
+	/* rtl92ee_is_tx_desc_closed() works on this snapshot */
+	rtlpci->tx_ring[q_idx].cur_tx_rp = current_tx_read_point;
+	rtlpci->tx_ring[q_idx].cur_tx_wp = current_tx_write_point;
 	rtlpci->tx_ring[q_idx].avl_desc = point_diff;
 	return point_diff;
 }
@@ -1048,26 +1051,10 @@ bool rtl92ee_is_tx_desc_closed(struct ieee80211_hw *hw, u8 hw_queue, u16 index)
 	static u8 stop_report_cnt;
 	struct rtl8192_tx_ring *ring = &rtlpci->tx_ring[hw_queue];
 
-	{
-		u16 point_diff = 0;
-		u16 cur_tx_rp, cur_tx_wp;
-		u32 tmpu32 = 0;
-
-		tmpu32 =
-		  rtl_read_dword(rtlpriv,
-				 get_desc_addr_fr_q_idx(hw_queue));
-		cur_tx_rp = (u16)((tmpu32 >> 16) & 0x0fff);
-		cur_tx_wp = (u16)(tmpu32 & 0x0fff);
-
-		ring->cur_tx_wp = cur_tx_wp;
-		ring->cur_tx_rp = cur_tx_rp;
-		point_diff = ((cur_tx_rp > cur_tx_wp) ?
-			      (cur_tx_rp - cur_tx_wp) :
-			      (TX_DESC_NUM_92E - cur_tx_wp + cur_tx_rp));
-
-		ring->avl_desc = point_diff;
-	}
-
+	/* The pointers were read by rtl92ee_get_available_desc() at the
+	 * start of this TX completion pass, so reclaiming a batch of
+	 * descriptors costs a single register read.
+	 */
 	read_point = ring->cur_tx_rp;
 	write_point = ring->cur_tx_wp;
 	available_desc_num = ring->avl_desc;
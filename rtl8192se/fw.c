@@ -144,14 +144,14 @@ static bool _rtl92s_cmd_send_packet(struct ieee80211_hw *hw,
 
 	ring = &rtlpci->tx_ring[TXCMD_QUEUE];
 
-	spin_lock_irqsave(&rtlpriv->locks.irq_th_lock, flags);
+	spin_lock_irqsave(&ring->lock, flags);
 
 	idx = (ring->idx + skb_queue_len(&ring->queue)) % ring->entries;
 	pdesc = &ring->desc[idx];
 	rtlpriv->cfg->ops->fill_tx_cmddesc(hw, (u8 *)pdesc, 1, 1, skb);
 	__skb_queue_tail(&ring->queue, skb);
 
-	spin_unlock_irqrestore(&rtlpriv->locks.irq_th_lock, flags);
+	spin_unlock_irqrestore(&ring->lock, flags);
 
 	return true;
 }
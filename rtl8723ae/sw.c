@@ -280,6 +280,7 @@ static const struct rtl_hal_cfg rtl8723e_hal_cfg = {
 	.name = "rtl8723e_pci",
 	.ops = &rtl8723e_hal_ops,
 	.mod_params = &rtl8723e_mod_params,
+	.hw_int_migration = true,
 	.maps[SYS_ISO_CTRL] = REG_SYS_ISO_CTRL,
 	.maps[SYS_FUNC_EN] = REG_SYS_FUNC_EN,
 	.maps[SYS_CLK] = REG_SYS_CLKR,
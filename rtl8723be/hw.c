@@ -53,7 +53,7 @@ static void _rtl8723be_return_beacon_queue_skb(struct ieee80211_hw *hw)
 	struct rtl8192_tx_ring *ring = &rtlpci->tx_ring[BEACON_QUEUE];
 	unsigned long flags;
 
-	spin_lock_irqsave(&rtlpriv->locks.irq_th_lock, flags);
+	spin_lock_irqsave(&ring->lock, flags);
 	while (skb_queue_len(&ring->queue)) {
 		struct rtl_tx_desc *entry = &ring->desc[ring->idx];
 		struct sk_buff *skb = __skb_dequeue(&ring->queue);
@@ -65,7 +65,7 @@ static void _rtl8723be_return_beacon_queue_skb(struct ieee80211_hw *hw)
 		kfree_skb(skb);
 		ring->idx = (ring->idx + 1) % ring->entries;
 	}
-	spin_unlock_irqrestore(&rtlpriv->locks.irq_th_lock, flags);
+	spin_unlock_irqrestore(&ring->lock, flags);
 }
 
 static void _rtl8723be_set_bcn_ctrl_reg(struct ieee80211_hw *hw,
@@ -724,6 +724,18 @@ void rtl8723be_set_hw_reg(struct ieee80211_hw *hw, u8 variable, u8 *val)
 		rtl8723be_fill_h2c_cmd(hw, H2C_8723B_KEEP_ALIVE_CTRL, 2, array);
 		}
 		break;
+	case HW_VAR_INT_MIGRATION: {
+		bool int_migration = *((bool *)val);
+
+		/* timer 25ns*0xfa0=100us for 0xf packets.
+		 * 0x306:Rx, 0x307:Tx
+		 */
+		if (int_migration)
+			rtl_write_dword(rtlpriv, REG_INT_MIG, 0xfe000fa0);
+		else
+			rtl_write_dword(rtlpriv, REG_INT_MIG, 0);
+		rtlpriv->dm.interrupt_migration = int_migration;
+		break; }
 	default:
 		RT_TRACE(rtlpriv, COMP_ERR, DBG_LOUD,
 			 "switch case %#x not processed\n", variable);
@@ -26,6 +26,7 @@
 #include "../wifi.h"
 #include "../pci.h"
 #include "../ps.h"
+#include "../core.h"
 #include "reg.h"
 #include "def.h"
 #include "phy.h"
@@ -612,6 +613,10 @@ static bool _rtl8723be_phy_config_mac_with_headerfile(struct ieee80211_hw *hw)
 
 	RT_TRACE(rtlpriv, COMP_INIT, DBG_TRACE, "Read rtl8723beMACPHY_Array\n");
 
+	if (rtl_phy_prog_load(hw, RTL_PHY_PROG_MAC, RTL8723BEMAC_1T_ARRAY,
+			      RTL8723BEMAC_1T_ARRAYLEN, RTL_PHY_WRITE_BYTE,
+			      RF90_PATH_A, _rtl8723be_check_positive))
+		return true;
 	return __rtl8723be_phy_config_with_headerfile(hw,
 			RTL8723BEMAC_1T_ARRAY, RTL8723BEMAC_1T_ARRAYLEN,
 			rtl_write_byte_with_val32);
@@ -621,16 +626,29 @@ static bool _rtl8723be_phy_config_bb_with_headerfile(struct ieee80211_hw *hw,
 						     u8 configtype)
 {
 
-	if (configtype == BASEBAND_CONFIG_PHY_REG)
+	if (configtype == BASEBAND_CONFIG_PHY_REG) {
+		if (rtl_phy_prog_load(hw, RTL_PHY_PROG_PHY_REG,
+				      RTL8723BEPHY_REG_1TARRAY,
+				      RTL8723BEPHY_REG_1TARRAYLEN,
+				      RTL_PHY_WRITE_BB, RF90_PATH_A,
+				      _rtl8723be_check_positive))
+			return true;
 		return __rtl8723be_phy_config_with_headerfile(hw,
 				RTL8723BEPHY_REG_1TARRAY,
 				RTL8723BEPHY_REG_1TARRAYLEN,
 				_rtl8723be_config_bb_reg);
-	else if (configtype == BASEBAND_CONFIG_AGC_TAB)
+	} else if (configtype == BASEBAND_CONFIG_AGC_TAB) {
+		if (rtl_phy_prog_load(hw, RTL_PHY_PROG_AGC_TAB,
+				      RTL8723BEAGCTAB_1TARRAY,
+				      RTL8723BEAGCTAB_1TARRAYLEN,
+				      RTL_PHY_WRITE_BB, RF90_PATH_A,
+				      _rtl8723be_check_positive))
+			return true;
 		return __rtl8723be_phy_config_with_headerfile(hw,
 				RTL8723BEAGCTAB_1TARRAY,
 				RTL8723BEAGCTAB_1TARRAYLEN,
 				rtl_set_bbreg_with_dwmask);
+	}
 
 	return false;
 }
@@ -772,10 +790,15 @@ bool rtl8723be_phy_config_rf_with_headerfile(struct ieee80211_hw *hw,
 	RT_TRACE(rtlpriv, COMP_INIT, DBG_LOUD, "Radio No %x\n", rfpath);
 	switch (rfpath) {
 	case RF90_PATH_A:
-		ret = __rtl8723be_phy_config_with_headerfile(hw,
-				RTL8723BE_RADIOA_1TARRAY,
-				RTL8723BE_RADIOA_1TARRAYLEN,
-				_rtl8723be_config_rf_radio_a);
+		if (!rtl_phy_prog_load(hw, RTL_PHY_PROG_RADIO_A,
+				       RTL8723BE_RADIOA_1TARRAY,
+				       RTL8723BE_RADIOA_1TARRAYLEN,
+				       RTL_PHY_WRITE_RF, RF90_PATH_A,
+				       _rtl8723be_check_positive))
+			ret = __rtl8723be_phy_config_with_headerfile(hw,
+					RTL8723BE_RADIOA_1TARRAY,
+					RTL8723BE_RADIOA_1TARRAYLEN,
+					_rtl8723be_config_rf_radio_a);
 
 		if (rtlhal->oem_id == RT_CID_819X_HP)
 			_rtl8723be_config_rf_radio_a(hw, 0x52, 0x7E4BD);
@@ -2279,6 +2302,7 @@ void rtl8723be_phy_iq_calibrate(struct ieee80211_hw *hw, bool b_recovery)
 	long reg_e94, reg_e9c, reg_ea4, reg_eac, reg_eb4, reg_ebc, reg_ec4;
 	long reg_ecc, reg_tmp = 0;
 	bool is12simular, is13simular, is23simular;
+	u64 start;
 	u32 iqk_bb_reg[9] = {
 		ROFDM0_XARXIQIMBALANCE,
 		ROFDM0_XBRXIQIMBALANCE,
@@ -2290,6 +2314,11 @@ void rtl8723be_phy_iq_calibrate(struct ieee80211_hw *hw, bool b_recovery)
 		ROFDM0_XDTXAFE,
 		ROFDM0_RXIQEXTANTA
 	};
+	u32 iqk_rx_reg[3] = {
+		ROFDM0_XARXIQIMBALANCE,
+		ROFDM0_XBRXIQIMBALANCE,
+		ROFDM0_RXIQEXTANTA
+	};
 	u32 path_sel_bb = 0; /* path_sel_rf = 0 */
 
 	if (rtlphy->lck_inprogress)
@@ -2304,6 +2333,24 @@ void rtl8723be_phy_iq_calibrate(struct ieee80211_hw *hw, bool b_recovery)
 						  rtlphy->iqk_bb_backup, 9);
 		goto label_done;
 	}
+
+	if (rtl_iqk_cache_reload(hw, iqk_rx_reg, 3, result[0])) {
+		if (result[0][0] != 0)
+			rtl8723_phy_path_a_fill_iqk_matrix(hw, true, result, 0,
+							   (result[0][2] == 0));
+		if (result[0][4] != 0)
+			_rtl8723be_phy_path_b_fill_iqk_matrix(hw, true,
+							      result, 0,
+							      !result[0][6]);
+		idx = _get_right_chnl_place_for_iqk(rtlphy->current_channel);
+		for (i = 0; i < IQK_MATRIX_REG_NUM; i++)
+			rtlphy->iqk_matrix[idx].value[0][i] = result[0][i];
+		rtlphy->iqk_matrix[idx].iqk_done = true;
+		rtl8723_save_adda_registers(hw, iqk_bb_reg,
+					    rtlphy->iqk_bb_backup, 9);
+		goto label_done;
+	}
+	start = ktime_get_ns();
 	/* Save RF Path */
 	path_sel_bb = rtl_get_bbreg(hw, 0x948, MASKDWORD);
 	/* path_sel_rf = rtl_get_rfreg(hw, RF90_PATH_A, 0xb0, 0xfffff); */
@@ -2406,6 +2453,9 @@ void rtl8723be_phy_iq_calibrate(struct ieee80211_hw *hw, bool b_recovery)
 	}
 	rtl8723_save_adda_registers(hw, iqk_bb_reg,
 				    rtlphy->iqk_bb_backup, 9);
+	if (final_candidate < 4)
+		rtl_iqk_cache_save(hw, iqk_rx_reg, 3, result[final_candidate],
+				   start);
 
 	pr_info("**** %s: reg 0x948 0x%x\n", __func__, path_sel_bb);
 	rtl_set_bbreg(hw, 0x948, MASKDWORD, path_sel_bb);
@@ -290,6 +290,8 @@ static const struct rtl_hal_cfg rtl8723be_hal_cfg = {
 	.name = "rtl8723be_pci",
 	.ops = &rtl8723be_hal_ops,
 	.mod_params = &rtl8723be_mod_params,
+	.tx_status_report = true,
+	.hw_int_migration = true,
 	.maps[SYS_ISO_CTRL] = REG_SYS_ISO_CTRL,
 	.maps[SYS_FUNC_EN] = REG_SYS_FUNC_EN,
 	.maps[SYS_CLK] = REG_SYS_CLKR,
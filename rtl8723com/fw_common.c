@@ -308,7 +308,7 @@ bool rtl8723_cmd_send_packet(struct ieee80211_hw *hw,
 
 	pskb = __skb_dequeue(&ring->queue);
 	kfree_skb(pskb);
-	spin_lock_irqsave(&rtlpriv->locks.irq_th_lock, flags);
+	spin_lock_irqsave(&ring->lock, flags);
 
 	pdesc = &ring->desc[0];
 	own = (u8) rtlpriv->cfg->ops->get_desc((u8 *)pdesc, true, HW_DESC_OWN);
@@ -317,7 +317,7 @@ bool rtl8723_cmd_send_packet(struct ieee80211_hw *hw,
 
 	__skb_queue_tail(&ring->queue, skb);
 
-	spin_unlock_irqrestore(&rtlpriv->locks.irq_th_lock, flags);
+	spin_unlock_irqrestore(&ring->lock, flags);
 
 	rtlpriv->cfg->ops->tx_polling(hw, BEACON_QUEUE);
 
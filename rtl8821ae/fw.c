@@ -27,6 +27,7 @@
 #include "../pci.h"
 #include "../base.h"
 #include "../core.h"
+#include "../rc.h"
 #include "reg.h"
 #include "def.h"
 #include "fw.h"
@@ -1973,6 +1974,7 @@ static void rtl8821ae_c2h_ra_report_handler(struct ieee80211_hw *hw,
 	u8 rate = cmd_buf[0] & 0x3F;
 
 	rtlhal->current_ra_rate = rtl8821ae_hw_rate_to_mrate(hw, rate);
+	rtl_rc_ra_report(hw, cmd_buf[1], rate, cmd_buf[0] & BIT(7));
 
 	rtl8821ae_dm_update_init_rate(hw, rate);
 }
@@ -26,6 +26,7 @@
 #include "../wifi.h"
 #include "../pci.h"
 #include "../ps.h"
+#include "../core.h"
 #include "reg.h"
 #include "def.h"
 #include "phy.h"
@@ -1608,51 +1609,17 @@ static void _rtl8821ae_phy_txpower_by_rate_configuration(struct ieee80211_hw *hw
 	_rtl8821ae_phy_convert_txpower_dbm_to_relative_value(hw);
 }
 
-/* string is in decimal */
-static bool _rtl8812ae_get_integer_from_string(char *str, u8 *pint)
-{
-	u16 i = 0;
-	*pint = 0;
-
-	while (str[i] != '\0') {
-		if (str[i] >= '0' && str[i] <= '9') {
-			*pint *= 10;
-			*pint += (str[i] - '0');
-		} else {
-			return false;
-		}
-		++i;
-	}
-
-	return true;
-}
-
-static bool _rtl8812ae_eq_n_byte(u8 *str1, u8 *str2, u32 num)
-{
-	if (num == 0)
-		return false;
-	while (num > 0) {
-		num--;
-		if (str1[num] != str2[num])
-			return false;
-	}
-	return true;
-}
-
 static s8 _rtl8812ae_phy_get_chnl_idx_of_txpwr_lmt(struct ieee80211_hw *hw,
 					      u8 band, u8 channel)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	s8 channel_index = -1;
-	u8  i = 0;
 
 	if (band == BAND_ON_2_4G)
 		channel_index = channel - 1;
 	else if (band == BAND_ON_5G) {
-		for (i = 0; i < sizeof(channel5g)/sizeof(u8); ++i) {
-			if (channel5g[i] == channel)
-				channel_index = i;
-		}
+		if (channel < RTL8821AE_TXPWR_LMT_CHNL_IDX_5G_LEN)
+			channel_index = RTL8821AE_TXPWR_LMT_CHNL_IDX_5G[channel];
 	} else
 		RT_TRACE(rtlpriv, COMP_POWER, DBG_LOUD, "Invalid Band %d in %s\n",
 			 band,  __func__);
@@ -1665,160 +1632,49 @@ static s8 _rtl8812ae_phy_get_chnl_idx_of_txpwr_lmt(struct ieee80211_hw *hw,
 	return channel_index;
 }
 
-static void _rtl8812ae_phy_set_txpower_limit(struct ieee80211_hw *hw, u8 *pregulation,
-				      u8 *pband, u8 *pbandwidth,
-				      u8 *prate_section, u8 *prf_path,
-				      u8 *pchannel, u8 *ppower_limit)
-{
-	struct rtl_priv *rtlpriv = rtl_priv(hw);
-	struct rtl_phy *rtlphy = &rtlpriv->phy;
-	u8 regulation = 0, bandwidth = 0, rate_section = 0, channel;
-	u8 channel_index;
-	s8 power_limit = 0, prev_power_limit, ret;
-
-	if (!_rtl8812ae_get_integer_from_string((char *)pchannel, &channel) ||
-	    !_rtl8812ae_get_integer_from_string((char *)ppower_limit,
-						&power_limit)) {
-		RT_TRACE(rtlpriv, COMP_INIT, DBG_TRACE,
-			 "Illegal index of pwr_lmt table [chnl %d][val %d]\n",
-			  channel, power_limit);
-	}
-
-	power_limit = power_limit > MAX_POWER_INDEX ?
-		      MAX_POWER_INDEX : power_limit;
-
-	if (_rtl8812ae_eq_n_byte(pregulation, (u8 *)("FCC"), 3))
-		regulation = 0;
-	else if (_rtl8812ae_eq_n_byte(pregulation, (u8 *)("MKK"), 3))
-		regulation = 1;
-	else if (_rtl8812ae_eq_n_byte(pregulation, (u8 *)("ETSI"), 4))
-		regulation = 2;
-	else if (_rtl8812ae_eq_n_byte(pregulation, (u8 *)("WW13"), 4))
-		regulation = 3;
-
-	if (_rtl8812ae_eq_n_byte(prate_section, (u8 *)("CCK"), 3))
-		rate_section = 0;
-	else if (_rtl8812ae_eq_n_byte(prate_section, (u8 *)("OFDM"), 4))
-		rate_section = 1;
-	else if (_rtl8812ae_eq_n_byte(prate_section, (u8 *)("HT"), 2) &&
-		 _rtl8812ae_eq_n_byte(prf_path, (u8 *)("1T"), 2))
-		rate_section = 2;
-	else if (_rtl8812ae_eq_n_byte(prate_section, (u8 *)("HT"), 2) &&
-		 _rtl8812ae_eq_n_byte(prf_path, (u8 *)("2T"), 2))
-		rate_section = 3;
-	else if (_rtl8812ae_eq_n_byte(prate_section, (u8 *)("VHT"), 3) &&
-		 _rtl8812ae_eq_n_byte(prf_path, (u8 *)("1T"), 2))
-		rate_section = 4;
-	else if (_rtl8812ae_eq_n_byte(prate_section, (u8 *)("VHT"), 3) &&
-		 _rtl8812ae_eq_n_byte(prf_path, (u8 *)("2T"), 2))
-		rate_section = 5;
-
-	if (_rtl8812ae_eq_n_byte(pbandwidth, (u8 *)("20M"), 3))
-		bandwidth = 0;
-	else if (_rtl8812ae_eq_n_byte(pbandwidth, (u8 *)("40M"), 3))
-		bandwidth = 1;
-	else if (_rtl8812ae_eq_n_byte(pbandwidth, (u8 *)("80M"), 3))
-		bandwidth = 2;
-	else if (_rtl8812ae_eq_n_byte(pbandwidth, (u8 *)("160M"), 4))
-		bandwidth = 3;
-
-	if (_rtl8812ae_eq_n_byte(pband, (u8 *)("2.4G"), 4)) {
-		ret = _rtl8812ae_phy_get_chnl_idx_of_txpwr_lmt(hw,
-							       BAND_ON_2_4G,
-							       channel);
-
-		if (ret == -1)
-			return;
-
-		channel_index = ret;
-
-		prev_power_limit = rtlphy->txpwr_limit_2_4g[regulation]
-						[bandwidth][rate_section]
-						[channel_index][RF90_PATH_A];
-
-		if (power_limit < prev_power_limit)
-			rtlphy->txpwr_limit_2_4g[regulation][bandwidth]
-				[rate_section][channel_index][RF90_PATH_A] =
-								   power_limit;
-
-		RT_TRACE(rtlpriv, COMP_INIT, DBG_TRACE,
-			 "2.4G [regula %d][bw %d][sec %d][chnl %d][val %d]\n",
-			  regulation, bandwidth, rate_section, channel_index,
-			  rtlphy->txpwr_limit_2_4g[regulation][bandwidth]
-				[rate_section][channel_index][RF90_PATH_A]);
-	} else if (_rtl8812ae_eq_n_byte(pband, (u8 *)("5G"), 2)) {
-		ret = _rtl8812ae_phy_get_chnl_idx_of_txpwr_lmt(hw,
-							       BAND_ON_5G,
-							       channel);
-
-		if (ret == -1)
-			return;
-
-		channel_index = ret;
-
-		prev_power_limit = rtlphy->txpwr_limit_5g[regulation][bandwidth]
-						[rate_section][channel_index]
-						[RF90_PATH_A];
-
-		if (power_limit < prev_power_limit)
-			rtlphy->txpwr_limit_5g[regulation][bandwidth]
-			[rate_section][channel_index][RF90_PATH_A] = power_limit;
-
-		RT_TRACE(rtlpriv, COMP_INIT, DBG_TRACE,
-			 "5G: [regul %d][bw %d][sec %d][chnl %d][val %d]\n",
-			  regulation, bandwidth, rate_section, channel,
-			  rtlphy->txpwr_limit_5g[regulation][bandwidth]
-				[rate_section][channel_index][RF90_PATH_A]);
-	} else {
-		RT_TRACE(rtlpriv, COMP_INIT, DBG_TRACE,
-			 "Cannot recognize the band info in %s\n", pband);
-		return;
-	}
-}
-
-static void _rtl8812ae_phy_config_bb_txpwr_lmt(struct ieee80211_hw *hw,
-					  u8 *regulation, u8 *band,
-					  u8 *bandwidth, u8 *rate_section,
-					  u8 *rf_path, u8 *channel,
-					  u8 *power_limit)
-{
-	_rtl8812ae_phy_set_txpower_limit(hw, regulation, band, bandwidth,
-					 rate_section, rf_path, channel,
-					 power_limit);
-}
-
+/* The limits are compiled from txpwr_lmt_*.txt by tools/txpwr_lmt.py,
+ * the tables only carry path A.
+ */
 static void _rtl8821ae_phy_read_and_config_txpwr_lmt(struct ieee80211_hw *hw)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_hal *rtlhal = rtl_hal(rtlpriv);
-	u32 i = 0;
-	u32 array_len;
-	u8 **array;
+	struct rtl_phy *rtlphy = &rtlpriv->phy;
+	const s8 (*lmt_2g)[MAX_2_4G_BANDWITH_NUM][MAX_RATE_SECTION_NUM]
+			  [CHANNEL_MAX_NUMBER_2G];
+	const s8 (*lmt_5g)[MAX_5G_BANDWITH_NUM][MAX_RATE_SECTION_NUM]
+			  [CHANNEL_MAX_NUMBER_5G];
+	u8 i, j, k, m;
 
 	if (rtlhal->hw_type == HARDWARE_TYPE_RTL8812AE) {
-		array_len = RTL8812AE_TXPWR_LMT_ARRAY_LEN;
-		array = RTL8812AE_TXPWR_LMT;
+		lmt_2g = RTL8812AE_TXPWR_LMT_2G;
+		lmt_5g = RTL8812AE_TXPWR_LMT_5G;
 	} else {
-		array_len = RTL8821AE_TXPWR_LMT_ARRAY_LEN;
-		array = RTL8821AE_TXPWR_LMT;
+		lmt_2g = RTL8821AE_TXPWR_LMT_2G;
+		lmt_5g = RTL8821AE_TXPWR_LMT_5G;
 	}
 
-	RT_TRACE(rtlpriv, COMP_INIT, DBG_TRACE,
-		 "\n");
-
-	for (i = 0; i < array_len; i += 7) {
-		u8 *regulation = array[i];
-		u8 *band = array[i+1];
-		u8 *bandwidth = array[i+2];
-		u8 *rate = array[i+3];
-		u8 *rf_path = array[i+4];
-		u8 *chnl = array[i+5];
-		u8 *val = array[i+6];
-
-		_rtl8812ae_phy_config_bb_txpwr_lmt(hw, regulation, band,
-						   bandwidth, rate, rf_path,
-						   chnl, val);
+	for (i = 0; i < MAX_REGULATION_NUM; ++i) {
+		for (j = 0; j < MAX_2_4G_BANDWITH_NUM; ++j)
+			for (k = 0; k < MAX_RATE_SECTION_NUM; ++k)
+				for (m = 0; m < CHANNEL_MAX_NUMBER_2G; ++m)
+					rtlphy->txpwr_limit_2_4g
+						[i][j][k][m][RF90_PATH_A] =
+						lmt_2g[i][j][k][m];
 	}
+	for (i = 0; i < MAX_REGULATION_NUM; ++i) {
+		for (j = 0; j < MAX_5G_BANDWITH_NUM; ++j)
+			for (k = 0; k < MAX_RATE_SECTION_NUM; ++k)
+				for (m = 0; m < CHANNEL_MAX_NUMBER_5G; ++m)
+					rtlphy->txpwr_limit_5g
+						[i][j][k][m][RF90_PATH_A] =
+						lmt_5g[i][j][k][m];
+	}
+
+	RT_TRACE(rtlpriv, COMP_INIT, DBG_TRACE,
+		 "txpwr_lmt of %s loaded\n",
+		 rtlhal->hw_type == HARDWARE_TYPE_RTL8812AE ?
+		 "8812ae" : "8821ae");
 }
 
 static bool _rtl8821ae_phy_bb8821a_config_parafile(struct ieee80211_hw *hw)
@@ -1829,6 +1685,7 @@ static bool _rtl8821ae_phy_bb8821a_config_parafile(struct ieee80211_hw *hw)
 	bool rtstatus;
 
 	_rtl8821ae_phy_init_txpower_limit(hw);
+	rtl8821ae_phy_txagc_shadow_reset(hw);
 
 	/* RegEnableTxPowerLimit == 1 for 8812a & 8821a */
 	if (rtlefuse->eeprom_regulatory != 2)
@@ -1936,6 +1793,10 @@ static bool _rtl8821ae_phy_config_mac_with_headerfile(struct ieee80211_hw *hw)
 	RT_TRACE(rtlpriv, COMP_INIT, DBG_LOUD,
 		 "Img: MAC_REG_ARRAY LEN %d\n", arraylength);
 
+	if (rtl_phy_prog_load(hw, RTL_PHY_PROG_MAC, ptrarray, arraylength,
+			      RTL_PHY_WRITE_BYTE, RF90_PATH_A,
+			      _rtl8821ae_check_positive))
+		return true;
 	return __rtl8821ae_phy_config_with_headerfile(hw,
 			ptrarray, arraylength, rtl_write_byte_with_val32);
 }
@@ -1957,6 +1818,10 @@ static bool _rtl8821ae_phy_config_bb_with_headerfile(struct ieee80211_hw *hw,
 			array_table = RTL8821AE_PHY_REG_ARRAY;
 		}
 
+		if (rtl_phy_prog_load(hw, RTL_PHY_PROG_PHY_REG, array_table,
+				      arraylen, RTL_PHY_WRITE_BB, RF90_PATH_A,
+				      _rtl8821ae_check_positive))
+			return true;
 		return __rtl8821ae_phy_config_with_headerfile(hw,
 				array_table, arraylen,
 				_rtl8821ae_config_bb_reg);
@@ -1969,6 +1834,10 @@ static bool _rtl8821ae_phy_config_bb_with_headerfile(struct ieee80211_hw *hw,
 			array_table = RTL8821AE_AGC_TAB_ARRAY;
 		}
 
+		if (rtl_phy_prog_load(hw, RTL_PHY_PROG_AGC_TAB, array_table,
+				      arraylen, RTL_PHY_WRITE_BB, RF90_PATH_A,
+				      _rtl8821ae_check_positive))
+			return true;
 		return __rtl8821ae_phy_config_with_headerfile(hw,
 				array_table, arraylen,
 				rtl_set_bbreg_with_dwmask);
@@ -2111,11 +1980,21 @@ bool rtl8812ae_phy_config_rf_with_headerfile(struct ieee80211_hw *hw,
 	rtstatus = true;
 	switch (rfpath) {
 	case RF90_PATH_A:
+		if (rtl_phy_prog_load(hw, RTL_PHY_PROG_RADIO_A,
+				      radioa_array_table_a, radioa_arraylen_a,
+				      RTL_PHY_WRITE_RF, RF90_PATH_A,
+				      _rtl8821ae_check_positive))
+			return true;
 		return __rtl8821ae_phy_config_with_headerfile(hw,
 				radioa_array_table_a, radioa_arraylen_a,
 				_rtl8821ae_config_rf_radio_a);
 		break;
 	case RF90_PATH_B:
+		if (rtl_phy_prog_load(hw, RTL_PHY_PROG_RADIO_B,
+				      radioa_array_table_b, radioa_arraylen_b,
+				      RTL_PHY_WRITE_RF, RF90_PATH_B,
+				      _rtl8821ae_check_positive))
+			return true;
 		return __rtl8821ae_phy_config_with_headerfile(hw,
 				radioa_array_table_b, radioa_arraylen_b,
 				_rtl8821ae_config_rf_radio_b);
@@ -2144,6 +2023,11 @@ bool rtl8821ae_phy_config_rf_with_headerfile(struct ieee80211_hw *hw,
 	rtstatus = true;
 	switch (rfpath) {
 	case RF90_PATH_A:
+		if (rtl_phy_prog_load(hw, RTL_PHY_PROG_RADIO_A,
+				      radioa_array_table, radioa_arraylen,
+				      RTL_PHY_WRITE_RF, RF90_PATH_A,
+				      _rtl8821ae_check_positive))
+			return true;
 		return __rtl8821ae_phy_config_with_headerfile(hw,
 			radioa_array_table, radioa_arraylen,
 			_rtl8821ae_config_rf_radio_a);
@@ -2767,458 +2651,51 @@ static u8 _rtl8821ae_get_txpower_index(struct ieee80211_hw *hw, u8 path,
 	return txpower;
 }
 
-static void _rtl8821ae_phy_set_txpower_index(struct ieee80211_hw *hw,
-					     u8 power_index, u8 path, u8 rate)
+/* byte of the rate in the TXAGC dwords of a path, MCS16-31 have no slot */
+static u8 _rtl8821ae_phy_txagc_slot(u8 rate)
 {
-	struct rtl_priv *rtlpriv = rtl_priv(hw);
-
-	if (path == RF90_PATH_A) {
-		switch (rate) {
-		case DESC_RATE1M:
-			rtl_set_bbreg(hw, RTXAGC_A_CCK11_CCK1,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATE2M:
-			rtl_set_bbreg(hw, RTXAGC_A_CCK11_CCK1,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATE5_5M:
-			rtl_set_bbreg(hw, RTXAGC_A_CCK11_CCK1,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATE11M:
-			rtl_set_bbreg(hw, RTXAGC_A_CCK11_CCK1,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATE6M:
-			rtl_set_bbreg(hw, RTXAGC_A_OFDM18_OFDM6,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATE9M:
-			rtl_set_bbreg(hw, RTXAGC_A_OFDM18_OFDM6,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATE12M:
-			rtl_set_bbreg(hw, RTXAGC_A_OFDM18_OFDM6,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATE18M:
-			rtl_set_bbreg(hw, RTXAGC_A_OFDM18_OFDM6,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATE24M:
-			rtl_set_bbreg(hw, RTXAGC_A_OFDM54_OFDM24,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATE36M:
-			rtl_set_bbreg(hw, RTXAGC_A_OFDM54_OFDM24,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATE48M:
-			rtl_set_bbreg(hw, RTXAGC_A_OFDM54_OFDM24,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATE54M:
-			rtl_set_bbreg(hw, RTXAGC_A_OFDM54_OFDM24,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEMCS0:
-			rtl_set_bbreg(hw, RTXAGC_A_MCS03_MCS00,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEMCS1:
-			rtl_set_bbreg(hw, RTXAGC_A_MCS03_MCS00,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEMCS2:
-			rtl_set_bbreg(hw, RTXAGC_A_MCS03_MCS00,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEMCS3:
-			rtl_set_bbreg(hw, RTXAGC_A_MCS03_MCS00,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEMCS4:
-			rtl_set_bbreg(hw, RTXAGC_A_MCS07_MCS04,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEMCS5:
-			rtl_set_bbreg(hw, RTXAGC_A_MCS07_MCS04,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEMCS6:
-			rtl_set_bbreg(hw, RTXAGC_A_MCS07_MCS04,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEMCS7:
-			rtl_set_bbreg(hw, RTXAGC_A_MCS07_MCS04,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEMCS8:
-			rtl_set_bbreg(hw, RTXAGC_A_MCS11_MCS08,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEMCS9:
-			rtl_set_bbreg(hw, RTXAGC_A_MCS11_MCS08,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEMCS10:
-			rtl_set_bbreg(hw, RTXAGC_A_MCS11_MCS08,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEMCS11:
-			rtl_set_bbreg(hw, RTXAGC_A_MCS11_MCS08,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEMCS12:
-			rtl_set_bbreg(hw, RTXAGC_A_MCS15_MCS12,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEMCS13:
-			rtl_set_bbreg(hw, RTXAGC_A_MCS15_MCS12,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEMCS14:
-			rtl_set_bbreg(hw, RTXAGC_A_MCS15_MCS12,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEMCS15:
-			rtl_set_bbreg(hw, RTXAGC_A_MCS15_MCS12,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS0:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS1INDEX3_NSS1INDEX0,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS1:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS1INDEX3_NSS1INDEX0,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS2:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS1INDEX3_NSS1INDEX0,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS3:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS1INDEX3_NSS1INDEX0,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS4:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS1INDEX7_NSS1INDEX4,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS5:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS1INDEX7_NSS1INDEX4,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS6:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS1INDEX7_NSS1INDEX4,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS7:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS1INDEX7_NSS1INDEX4,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS8:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS2INDEX1_NSS1INDEX8,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS9:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS2INDEX1_NSS1INDEX8,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS0:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS2INDEX1_NSS1INDEX8,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS1:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS2INDEX1_NSS1INDEX8,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS2:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS2INDEX5_NSS2INDEX2,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS3:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS2INDEX5_NSS2INDEX2,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS4:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS2INDEX5_NSS2INDEX2,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS5:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS2INDEX5_NSS2INDEX2,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS6:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS2INDEX9_NSS2INDEX6,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS7:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS2INDEX9_NSS2INDEX6,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS8:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS2INDEX9_NSS2INDEX6,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS9:
-			rtl_set_bbreg(hw, RTXAGC_A_NSS2INDEX9_NSS2INDEX6,
-				      MASKBYTE3, power_index);
-			break;
-		default:
-			RT_TRACE(rtlpriv, COMP_POWER, DBG_LOUD,
-				"Invalid Rate!!\n");
-			break;
-		}
-	} else if (path == RF90_PATH_B) {
-		switch (rate) {
-		case DESC_RATE1M:
-			rtl_set_bbreg(hw, RTXAGC_B_CCK11_CCK1,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATE2M:
-			rtl_set_bbreg(hw, RTXAGC_B_CCK11_CCK1,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATE5_5M:
-			rtl_set_bbreg(hw, RTXAGC_B_CCK11_CCK1,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATE11M:
-			rtl_set_bbreg(hw, RTXAGC_B_CCK11_CCK1,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATE6M:
-			rtl_set_bbreg(hw, RTXAGC_B_OFDM18_OFDM6,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATE9M:
-			rtl_set_bbreg(hw, RTXAGC_B_OFDM18_OFDM6,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATE12M:
-			rtl_set_bbreg(hw, RTXAGC_B_OFDM18_OFDM6,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATE18M:
-			rtl_set_bbreg(hw, RTXAGC_B_OFDM18_OFDM6,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATE24M:
-			rtl_set_bbreg(hw, RTXAGC_B_OFDM54_OFDM24,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATE36M:
-			rtl_set_bbreg(hw, RTXAGC_B_OFDM54_OFDM24,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATE48M:
-			rtl_set_bbreg(hw, RTXAGC_B_OFDM54_OFDM24,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATE54M:
-			rtl_set_bbreg(hw, RTXAGC_B_OFDM54_OFDM24,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEMCS0:
-			rtl_set_bbreg(hw, RTXAGC_B_MCS03_MCS00,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEMCS1:
-			rtl_set_bbreg(hw, RTXAGC_B_MCS03_MCS00,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEMCS2:
-			rtl_set_bbreg(hw, RTXAGC_B_MCS03_MCS00,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEMCS3:
-			rtl_set_bbreg(hw, RTXAGC_B_MCS03_MCS00,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEMCS4:
-			rtl_set_bbreg(hw, RTXAGC_B_MCS07_MCS04,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEMCS5:
-			rtl_set_bbreg(hw, RTXAGC_B_MCS07_MCS04,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEMCS6:
-			rtl_set_bbreg(hw, RTXAGC_B_MCS07_MCS04,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEMCS7:
-			rtl_set_bbreg(hw, RTXAGC_B_MCS07_MCS04,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEMCS8:
-			rtl_set_bbreg(hw, RTXAGC_B_MCS11_MCS08,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEMCS9:
-			rtl_set_bbreg(hw, RTXAGC_B_MCS11_MCS08,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEMCS10:
-			rtl_set_bbreg(hw, RTXAGC_B_MCS11_MCS08,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEMCS11:
-			rtl_set_bbreg(hw, RTXAGC_B_MCS11_MCS08,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEMCS12:
-			rtl_set_bbreg(hw, RTXAGC_B_MCS15_MCS12,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEMCS13:
-			rtl_set_bbreg(hw, RTXAGC_B_MCS15_MCS12,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEMCS14:
-			rtl_set_bbreg(hw, RTXAGC_B_MCS15_MCS12,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEMCS15:
-			rtl_set_bbreg(hw, RTXAGC_B_MCS15_MCS12,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS0:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS1INDEX3_NSS1INDEX0,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS1:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS1INDEX3_NSS1INDEX0,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS2:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS1INDEX3_NSS1INDEX0,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS3:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS1INDEX3_NSS1INDEX0,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS4:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS1INDEX7_NSS1INDEX4,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS5:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS1INDEX7_NSS1INDEX4,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS6:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS1INDEX7_NSS1INDEX4,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS7:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS1INDEX7_NSS1INDEX4,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS8:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS2INDEX1_NSS1INDEX8,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEVHT1SS_MCS9:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS2INDEX1_NSS1INDEX8,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS0:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS2INDEX1_NSS1INDEX8,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS1:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS2INDEX1_NSS1INDEX8,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS2:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS2INDEX5_NSS2INDEX2,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS3:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS2INDEX5_NSS2INDEX2,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS4:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS2INDEX5_NSS2INDEX2,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS5:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS2INDEX5_NSS2INDEX2,
-				      MASKBYTE3, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS6:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS2INDEX9_NSS2INDEX6,
-				      MASKBYTE0, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS7:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS2INDEX9_NSS2INDEX6,
-				      MASKBYTE1, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS8:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS2INDEX9_NSS2INDEX6,
-				      MASKBYTE2, power_index);
-			break;
-		case DESC_RATEVHT2SS_MCS9:
-			rtl_set_bbreg(hw, RTXAGC_B_NSS2INDEX9_NSS2INDEX6,
-				      MASKBYTE3, power_index);
-			break;
-		default:
-			RT_TRACE(rtlpriv, COMP_POWER, DBG_LOUD,
-				 "Invalid Rate!!\n");
-			break;
-		}
-	} else {
-		RT_TRACE(rtlpriv, COMP_POWER, DBG_LOUD,
-			 "Invalid RFPath!!\n");
-	}
+	if (rate <= DESC_RATEMCS15)
+		return rate;
+	return rate - DESC_RATEVHT1SS_MCS0 + DESC_RATEMCS15 + 1;
 }
 
-static void _rtl8821ae_phy_set_txpower_level_by_path(struct ieee80211_hw *hw,
-						     u8 *array, u8 path,
-						     u8 channel, u8 size)
+static void _rtl8821ae_phy_txagc_fill_rates(struct ieee80211_hw *hw,
+					    struct rtl_txpwr_agc *agc,
+					    const u8 *rates, u8 size,
+					    u8 path, u8 channel)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_phy *rtlphy = &rtlpriv->phy;
-	u8 i;
+	u8 i, slot;
 	u8 power_index;
 
 	for (i = 0; i < size; i++) {
 		power_index =
-		  _rtl8821ae_get_txpower_index(hw, path, array[i],
+		  _rtl8821ae_get_txpower_index(hw, path, rates[i],
 					       rtlphy->current_chan_bw,
 					       channel);
-		_rtl8821ae_phy_set_txpower_index(hw, power_index, path,
-						 array[i]);
+		slot = _rtl8821ae_phy_txagc_slot(rates[i]);
+		agc->agc[slot / 4] |= (u32)power_index << ((slot % 4) * 8);
+		agc->set |= BIT_ULL(slot);
 	}
 }
 
 static void _rtl8821ae_phy_txpower_training_by_path(struct ieee80211_hw *hw,
+						    struct rtl_txpwr_agc *agc,
 						    u8 bw, u8 channel, u8 path)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_phy *rtlphy = &rtlpriv->phy;
 
 	u8 i;
-	u32 power_level, data, offset;
+	u32 power_level, data;
 
 	if (path >= rtlphy->num_total_rfpath)
 		return;
 
 	data = 0;
-	if (path == RF90_PATH_A) {
-		power_level =
-			_rtl8821ae_get_txpower_index(hw, RF90_PATH_A,
-			DESC_RATEMCS7, bw, channel);
-		offset =  RA_TXPWRTRAING;
-	} else {
-		power_level =
-			_rtl8821ae_get_txpower_index(hw, RF90_PATH_B,
-			DESC_RATEMCS7, bw, channel);
-		offset =  RB_TXPWRTRAING;
-	}
+	power_level = _rtl8821ae_get_txpower_index(hw, path, DESC_RATEMCS7,
+						   bw, channel);
 
 	for (i = 0; i < 3; i++) {
 		if (i == 0)
@@ -3230,68 +2707,251 @@ static void _rtl8821ae_phy_txpower_training_by_path(struct ieee80211_hw *hw,
 
 		data |= (((power_level > 2) ? (power_level) : 2) << (i * 8));
 	}
-	rtl_set_bbreg(hw, offset, 0xffffff, data);
+	agc->training = data;
+	agc->set |= BIT_ULL(RTL_TXAGC_TRAINING);
 }
 
-void rtl8821ae_phy_set_txpower_level_by_path(struct ieee80211_hw *hw,
-					     u8 channel, u8 path)
+static void _rtl8821ae_phy_txagc_fill(struct ieee80211_hw *hw,
+				      struct rtl_txpwr_agc *agc,
+				      u8 channel, u8 path)
 {
-	/* struct rtl_efuse *rtlefuse = rtl_efuse(rtl_priv(hw)); */
 	struct rtl_hal *rtlhal = rtl_hal(rtl_priv(hw));
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_phy *rtlphy = &rtlpriv->phy;
-	u8 cck_rates[]  = {DESC_RATE1M, DESC_RATE2M, DESC_RATE5_5M,
-			      DESC_RATE11M};
-	u8 sizes_of_cck_retes = 4;
-	u8 ofdm_rates[]  = {DESC_RATE6M, DESC_RATE9M, DESC_RATE12M,
-				DESC_RATE18M, DESC_RATE24M, DESC_RATE36M,
-				DESC_RATE48M, DESC_RATE54M};
-	u8 sizes_of_ofdm_retes = 8;
-	u8 ht_rates_1t[]  = {DESC_RATEMCS0, DESC_RATEMCS1, DESC_RATEMCS2,
-				DESC_RATEMCS3, DESC_RATEMCS4, DESC_RATEMCS5,
-				DESC_RATEMCS6, DESC_RATEMCS7};
-	u8 sizes_of_ht_retes_1t = 8;
-	u8 ht_rates_2t[]  = {DESC_RATEMCS8, DESC_RATEMCS9,
-				DESC_RATEMCS10, DESC_RATEMCS11,
-				DESC_RATEMCS12, DESC_RATEMCS13,
-				DESC_RATEMCS14, DESC_RATEMCS15};
-	u8 sizes_of_ht_retes_2t = 8;
-	u8 vht_rates_1t[]  = {DESC_RATEVHT1SS_MCS0, DESC_RATEVHT1SS_MCS1,
-				DESC_RATEVHT1SS_MCS2, DESC_RATEVHT1SS_MCS3,
-				DESC_RATEVHT1SS_MCS4, DESC_RATEVHT1SS_MCS5,
-				DESC_RATEVHT1SS_MCS6, DESC_RATEVHT1SS_MCS7,
-			     DESC_RATEVHT1SS_MCS8, DESC_RATEVHT1SS_MCS9};
-	u8 vht_rates_2t[]  = {DESC_RATEVHT2SS_MCS0, DESC_RATEVHT2SS_MCS1,
-				DESC_RATEVHT2SS_MCS2, DESC_RATEVHT2SS_MCS3,
-				DESC_RATEVHT2SS_MCS4, DESC_RATEVHT2SS_MCS5,
-				DESC_RATEVHT2SS_MCS6, DESC_RATEVHT2SS_MCS7,
-				DESC_RATEVHT2SS_MCS8, DESC_RATEVHT2SS_MCS9};
-	u8 sizes_of_vht_retes = 10;
+	static const u8 cck_rates[]  = {DESC_RATE1M, DESC_RATE2M,
+					DESC_RATE5_5M, DESC_RATE11M};
+	static const u8 ofdm_rates[]  = {DESC_RATE6M, DESC_RATE9M,
+					 DESC_RATE12M, DESC_RATE18M,
+					 DESC_RATE24M, DESC_RATE36M,
+					 DESC_RATE48M, DESC_RATE54M};
+	static const u8 ht_rates_1t[]  = {DESC_RATEMCS0, DESC_RATEMCS1,
+					  DESC_RATEMCS2, DESC_RATEMCS3,
+					  DESC_RATEMCS4, DESC_RATEMCS5,
+					  DESC_RATEMCS6, DESC_RATEMCS7};
+	static const u8 ht_rates_2t[]  = {DESC_RATEMCS8, DESC_RATEMCS9,
+					  DESC_RATEMCS10, DESC_RATEMCS11,
+					  DESC_RATEMCS12, DESC_RATEMCS13,
+					  DESC_RATEMCS14, DESC_RATEMCS15};
+	static const u8 vht_rates_1t[]  = {DESC_RATEVHT1SS_MCS0,
+					   DESC_RATEVHT1SS_MCS1,
+					   DESC_RATEVHT1SS_MCS2,
+					   DESC_RATEVHT1SS_MCS3,
+					   DESC_RATEVHT1SS_MCS4,
+					   DESC_RATEVHT1SS_MCS5,
+					   DESC_RATEVHT1SS_MCS6,
+					   DESC_RATEVHT1SS_MCS7,
+					   DESC_RATEVHT1SS_MCS8,
+					   DESC_RATEVHT1SS_MCS9};
+	static const u8 vht_rates_2t[]  = {DESC_RATEVHT2SS_MCS0,
+					   DESC_RATEVHT2SS_MCS1,
+					   DESC_RATEVHT2SS_MCS2,
+					   DESC_RATEVHT2SS_MCS3,
+					   DESC_RATEVHT2SS_MCS4,
+					   DESC_RATEVHT2SS_MCS5,
+					   DESC_RATEVHT2SS_MCS6,
+					   DESC_RATEVHT2SS_MCS7,
+					   DESC_RATEVHT2SS_MCS8,
+					   DESC_RATEVHT2SS_MCS9};
+
+	memset(agc, 0, sizeof(*agc));
+	agc->remnant_ofdm = rtlpriv->dm.remnant_ofdm_swing_idx[path];
+	agc->remnant_cck = rtlpriv->dm.remnant_cck_idx;
 
 	if (rtlhal->current_bandtype == BAND_ON_2_4G)
-		_rtl8821ae_phy_set_txpower_level_by_path(hw, cck_rates, path, channel,
-							 sizes_of_cck_retes);
+		_rtl8821ae_phy_txagc_fill_rates(hw, agc, cck_rates,
+						ARRAY_SIZE(cck_rates),
+						path, channel);
 
-	_rtl8821ae_phy_set_txpower_level_by_path(hw, ofdm_rates, path, channel,
-						 sizes_of_ofdm_retes);
-	_rtl8821ae_phy_set_txpower_level_by_path(hw, ht_rates_1t, path, channel,
-						 sizes_of_ht_retes_1t);
-	_rtl8821ae_phy_set_txpower_level_by_path(hw, vht_rates_1t, path, channel,
-						 sizes_of_vht_retes);
+	_rtl8821ae_phy_txagc_fill_rates(hw, agc, ofdm_rates,
+					ARRAY_SIZE(ofdm_rates), path, channel);
+	_rtl8821ae_phy_txagc_fill_rates(hw, agc, ht_rates_1t,
+					ARRAY_SIZE(ht_rates_1t), path, channel);
+	_rtl8821ae_phy_txagc_fill_rates(hw, agc, vht_rates_1t,
+					ARRAY_SIZE(vht_rates_1t), path, channel);
 
 	if (rtlphy->num_total_rfpath >= 2) {
-		_rtl8821ae_phy_set_txpower_level_by_path(hw, ht_rates_2t, path,
-							 channel,
-							 sizes_of_ht_retes_2t);
-		_rtl8821ae_phy_set_txpower_level_by_path(hw, vht_rates_2t, path,
-							 channel,
-							 sizes_of_vht_retes);
+		_rtl8821ae_phy_txagc_fill_rates(hw, agc, ht_rates_2t,
+						ARRAY_SIZE(ht_rates_2t),
+						path, channel);
+		_rtl8821ae_phy_txagc_fill_rates(hw, agc, vht_rates_2t,
+						ARRAY_SIZE(vht_rates_2t),
+						path, channel);
 	}
 
-	_rtl8821ae_phy_txpower_training_by_path(hw, rtlphy->current_chan_bw,
+	_rtl8821ae_phy_txpower_training_by_path(hw, agc,
+						rtlphy->current_chan_bw,
 						channel, path);
 }
 
+/* The indexes only depend on the channel, the bandwidth, the path, efuse
+ * and the thermal remnants, so the entry of the current channel is reused
+ * until one of them moves.
+ */
+static struct rtl_txpwr_agc *
+_rtl8821ae_phy_txpwr_cache_entry(struct ieee80211_hw *hw, u8 channel, u8 path)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_hal *rtlhal = rtl_hal(rtlpriv);
+	struct rtl_phy *rtlphy = &rtlpriv->phy;
+	u8 bw = rtlphy->current_chan_bw;
+	int idx;
+
+	/* the limit lookup uses current_channel, not the argument */
+	if (!rtlphy->txpwr_cache || channel != rtlphy->current_channel ||
+	    path >= RTL_TXPWR_CACHE_PATH || bw >= RTL_TXPWR_CACHE_BW)
+		return NULL;
+
+	if (rtlhal->current_bandtype == BAND_ON_2_4G &&
+	    channel >= 1 && channel <= CHANNEL_MAX_NUMBER_2G)
+		idx = channel - 1;
+	else if (rtlhal->current_bandtype == BAND_ON_5G && channel > 14 &&
+		 channel < RTL8821AE_TXPWR_LMT_CHNL_IDX_5G_LEN &&
+		 RTL8821AE_TXPWR_LMT_CHNL_IDX_5G[channel] >= 0)
+		idx = CHANNEL_MAX_NUMBER_2G +
+		      RTL8821AE_TXPWR_LMT_CHNL_IDX_5G[channel];
+	else
+		return NULL;
+
+	return &rtlphy->txpwr_cache[(idx * RTL_TXPWR_CACHE_BW + bw) *
+				    RTL_TXPWR_CACHE_PATH + path];
+}
+
+void rtl8821ae_phy_txpwr_cache_invalidate(struct ieee80211_hw *hw)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_phy *rtlphy = &rtlpriv->phy;
+
+	/* entries are zeroed, gen 0 must never be valid */
+	if (!++rtlphy->txpwr_cache_gen)
+		rtlphy->txpwr_cache_gen = 1;
+}
+
+static void _rtl8821ae_phy_txagc_write(struct ieee80211_hw *hw, u8 path,
+				       u8 i, u32 reg, u32 mask, u32 data)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_phy *rtlphy = &rtlpriv->phy;
+	u32 *shadow = &rtlphy->txagc_shadow[path][i];
+	u32 *valid = &rtlphy->txagc_shadow_mask[path][i];
+
+	data &= mask;
+	if ((*valid & mask) == mask && (*shadow & mask) == data) {
+		rtlphy->txpwr_stats.skips++;
+		return;
+	}
+
+	/* masks are contiguous bytes, MASKDWORD skips the read back */
+	rtl_set_bbreg(hw, reg, mask, data >> __ffs(mask));
+	*shadow = (*shadow & ~mask) | data;
+	*valid |= mask;
+	rtlphy->txpwr_stats.writes++;
+}
+
+static void _rtl8821ae_phy_txagc_apply(struct ieee80211_hw *hw, u8 path,
+				       struct rtl_txpwr_agc *agc)
+{
+	u32 base = path == RF90_PATH_A ? RTXAGC_A_CCK11_CCK1 :
+					 RTXAGC_B_CCK11_CCK1;
+	u32 mask;
+	u8 i, j;
+
+	if (path >= RTL_TXPWR_CACHE_PATH) {
+		RT_TRACE(rtl_priv(hw), COMP_POWER, DBG_LOUD,
+			 "Invalid RFPath!!\n");
+		return;
+	}
+
+	for (i = 0; i < RTL_TXAGC_NUM; i++) {
+		mask = 0;
+		for (j = 0; j < 4; j++)
+			if (agc->set & BIT_ULL(i * 4 + j))
+				mask |= 0xffU << (j * 8);
+		if (mask)
+			_rtl8821ae_phy_txagc_write(hw, path, i, base + i * 4,
+						   mask, agc->agc[i]);
+	}
+
+	if (agc->set & BIT_ULL(RTL_TXAGC_TRAINING))
+		_rtl8821ae_phy_txagc_write(hw, path, RTL_TXAGC_NUM,
+					   path == RF90_PATH_A ?
+					   RA_TXPWRTRAING : RB_TXPWRTRAING,
+					   0xffffff, agc->training);
+}
+
+/* what every channel set did before the cache: one read-modify-write of a
+ * single byte per rate, used by txpwr_nocache to measure against
+ */
+static void _rtl8821ae_phy_txagc_write_bytes(struct ieee80211_hw *hw, u8 path,
+					     struct rtl_txpwr_agc *agc)
+{
+	u32 base = path == RF90_PATH_A ? RTXAGC_A_CCK11_CCK1 :
+					 RTXAGC_B_CCK11_CCK1;
+	u8 i, j;
+
+	if (path >= RTL_TXPWR_CACHE_PATH)
+		return;
+
+	for (i = 0; i < RTL_TXAGC_NUM; i++)
+		for (j = 0; j < 4; j++)
+			if (agc->set & BIT_ULL(i * 4 + j))
+				rtl_set_bbreg(hw, base + i * 4,
+					      0xffU << (j * 8),
+					      (agc->agc[i] >> (j * 8)) & 0xff);
+
+	if (agc->set & BIT_ULL(RTL_TXAGC_TRAINING))
+		rtl_set_bbreg(hw, path == RF90_PATH_A ?
+			      RA_TXPWRTRAING : RB_TXPWRTRAING,
+			      0xffffff, agc->training);
+
+	/* the shadow no longer matches what was written */
+	rtl8821ae_phy_txagc_shadow_reset(hw);
+}
+
+void rtl8821ae_phy_set_txpower_level_by_path(struct ieee80211_hw *hw,
+					     u8 channel, u8 path)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	struct rtl_phy *rtlphy = &rtlpriv->phy;
+	struct rtl_txpwr_stats *stats = &rtlphy->txpwr_stats;
+	struct rtl_txpwr_agc local, *agc;
+	u64 start = ktime_get_ns();
+
+	if (rtlpriv->cfg->mod_params->txpwr_nocache) {
+		_rtl8821ae_phy_txagc_fill(hw, &local, channel, path);
+		_rtl8821ae_phy_txagc_write_bytes(hw, path, &local);
+		stats->bypasses++;
+		stats->bypass_ns += ktime_get_ns() - start;
+		return;
+	}
+
+	agc = _rtl8821ae_phy_txpwr_cache_entry(hw, channel, path);
+	if (agc && agc->gen == rtlphy->txpwr_cache_gen &&
+	    agc->remnant_ofdm == rtlpriv->dm.remnant_ofdm_swing_idx[path] &&
+	    agc->remnant_cck == rtlpriv->dm.remnant_cck_idx) {
+		_rtl8821ae_phy_txagc_apply(hw, path, agc);
+		stats->hits++;
+		stats->hit_ns += ktime_get_ns() - start;
+		return;
+	}
+
+	if (!agc)
+		agc = &local;
+	_rtl8821ae_phy_txagc_fill(hw, agc, channel, path);
+	agc->gen = rtlphy->txpwr_cache_gen;
+	_rtl8821ae_phy_txagc_apply(hw, path, agc);
+	stats->misses++;
+	stats->miss_ns += ktime_get_ns() - start;
+}
+
+/* the registers are reset by the BB tables, forget what was written */
+void rtl8821ae_phy_txagc_shadow_reset(struct ieee80211_hw *hw)
+{
+	struct rtl_phy *rtlphy = &rtl_priv(hw)->phy;
+
+	memset(rtlphy->txagc_shadow_mask, 0,
+	       sizeof(rtlphy->txagc_shadow_mask));
+}
+
 /*just in case, write txpower in DW, to reduce time*/
 void rtl8821ae_phy_set_txpower_level(struct ieee80211_hw *hw, u8 channel)
 {
@@ -3762,7 +3422,8 @@ static void _rtl8821ae_iqk_rx_fill_iqc(struct ieee80211_hw *hw,
 
 #define cal_num 10
 
-static void _rtl8821ae_iqk_tx(struct ieee80211_hw *hw, enum radio_path path)
+/* returns true when both the TX and the RX IQC converged */
+static bool _rtl8821ae_iqk_tx(struct ieee80211_hw *hw, enum radio_path path)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_phy *rtlphy = &rtlpriv->phy;
@@ -4449,6 +4110,8 @@ static void _rtl8821ae_iqk_tx(struct ieee80211_hw *hw, enum radio_path path)
 	default:
 		break;
 	}
+
+	return tx_finish == 1 && rx_finish == 1;
 }
 
 static void _rtl8821ae_iqk_restore_rf(struct ieee80211_hw *hw,
@@ -4521,7 +4184,7 @@ static void _rtl8821ae_iqk_restore_macbb(struct ieee80211_hw *hw,
 #define AFE_REG_NUM 12
 #define RF_REG_NUM 3
 
-static void _rtl8821ae_phy_iq_calibrate(struct ieee80211_hw *hw)
+static bool _rtl8821ae_phy_iq_calibrate(struct ieee80211_hw *hw)
 {
 	u32	macbb_backup[MACBB_REG_NUM];
 	u32 afe_backup[AFE_REG_NUM];
@@ -4536,6 +4199,7 @@ static void _rtl8821ae_phy_iq_calibrate(struct ieee80211_hw *hw)
 		0xc78, 0xc7c, 0xc80, 0xc84, 0xcb8
 	};
 	u32	backup_rf_reg[RF_REG_NUM] = {0x65, 0x8f, 0x0};
+	bool ok;
 
 	_rtl8821ae_iqk_backup_macbb(hw, macbb_backup, backup_macbb_reg,
 				    MACBB_REG_NUM);
@@ -4544,13 +4208,75 @@ static void _rtl8821ae_phy_iq_calibrate(struct ieee80211_hw *hw)
 				 RF_REG_NUM);
 
 	_rtl8821ae_iqk_configure_mac(hw);
-	_rtl8821ae_iqk_tx(hw, RF90_PATH_A);
+	ok = _rtl8821ae_iqk_tx(hw, RF90_PATH_A);
 	_rtl8821ae_iqk_restore_rf(hw, RF90_PATH_A, backup_rf_reg, rfa_backup,
 				  RF_REG_NUM);
 
 	_rtl8821ae_iqk_restore_afe(hw, afe_backup, backup_afe_reg, AFE_REG_NUM);
 	_rtl8821ae_iqk_restore_macbb(hw, macbb_backup, backup_macbb_reg,
 				     MACBB_REG_NUM);
+	return ok;
+}
+
+/* 0xccc/0xcd4 on page C1 hold the TX IQC, 0xc10 on page C the RX IQC */
+#define IQK_CACHE_VAL_NUM 3
+
+static void _rtl8821ae_iqk_save_iqc(struct ieee80211_hw *hw, u32 *val)
+{
+	u32 page = rtl_get_bbreg(hw, 0x82c, BIT(31));
+
+	rtl_set_bbreg(hw, 0x82c, BIT(31), 0x1); /* [31] = 1 --> Page C1 */
+	val[0] = rtl_get_bbreg(hw, 0xccc, 0x000007ff);
+	val[1] = rtl_get_bbreg(hw, 0xcd4, 0x000007ff);
+	rtl_set_bbreg(hw, 0x82c, BIT(31), 0x0); /* [31] = 0 --> Page C */
+	val[2] = rtl_get_bbreg(hw, 0xc10, 0x03ff03ff);
+	rtl_set_bbreg(hw, 0x82c, BIT(31), page);
+}
+
+static void _rtl8821ae_iqk_reload_iqc(struct ieee80211_hw *hw,
+				      const u32 *val)
+{
+	struct rtl_priv *rtlpriv = rtl_priv(hw);
+	u32 page = rtl_get_bbreg(hw, 0x82c, BIT(31));
+
+	rtl_set_bbreg(hw, 0x82c, BIT(31), 0x1); /* [31] = 1 --> Page C1 */
+	rtl_write_dword(rtlpriv, 0xc90, 0x00000080);
+	rtl_write_dword(rtlpriv, 0xcc4, 0x20040000);
+	rtl_write_dword(rtlpriv, 0xcc8, 0x20000000);
+	rtl_set_bbreg(hw, 0xccc, 0x000007ff, val[0]);
+	rtl_set_bbreg(hw, 0xcd4, 0x000007ff, val[1]);
+	rtl_set_bbreg(hw, 0x82c, BIT(31), 0x0); /* [31] = 0 --> Page C */
+	rtl_set_bbreg(hw, 0xc10, 0x03ff03ff, val[2]);
+	rtl_set_bbreg(hw, 0x82c, BIT(31), page);
+	RT_TRACE(rtlpriv, COMP_IQK, DBG_LOUD,
+		 "IQC reloaded: 0xccc = %x 0xcd4 = %x 0xc10 = %x\n",
+		 val[0], val[1], val[2]);
+}
+
+/* reapplies a cached IQC of this channel group and temperature when it is
+ * young enough, calibrates otherwise. A calibration that fell back to the
+ * default IQC is not cached, so the next call calibrates again.
+ */
+static void _rtl8821ae_phy_iq_calibrate_cached(struct ieee80211_hw *hw)
+{
+	struct rtl_cal_entry *entry;
+	u32 val[IQK_CACHE_VAL_NUM];
+	u64 start;
+
+	entry = rtl_cal_cache_get(hw);
+	if (entry && entry->num == IQK_CACHE_VAL_NUM) {
+		_rtl8821ae_iqk_reload_iqc(hw, entry->val);
+		return;
+	}
+
+	start = ktime_get_ns();
+	if (!_rtl8821ae_phy_iq_calibrate(hw)) {
+		RT_TRACE(rtl_priv(hw), COMP_IQK, DBG_LOUD,
+			 "IQK did not converge, result not cached\n");
+		return;
+	}
+	_rtl8821ae_iqk_save_iqc(hw, val);
+	rtl_cal_cache_put(hw, val, IQK_CACHE_VAL_NUM, ktime_get_ns() - start);
 }
 
 static void _rtl8821ae_phy_set_rfpath_switch(struct ieee80211_hw *hw, bool main)
@@ -4592,7 +4318,7 @@ void rtl8821ae_phy_iq_calibrate(struct ieee80211_hw *hw, bool b_recovery)
 		rtlphy->lck_inprogress = true;
 		spin_unlock(&rtlpriv->locks.iqk_lock);
 
-		_rtl8821ae_phy_iq_calibrate(hw);
+		_rtl8821ae_phy_iq_calibrate_cached(hw);
 
 		spin_lock(&rtlpriv->locks.iqk_lock);
 		rtlphy->lck_inprogress = false;
@@ -4635,7 +4361,8 @@ void rtl8821ae_do_iqk(struct ieee80211_hw *hw, u8 delta_thermal_index,
 	rtl8821ae_reset_iqk_result(hw);
 
 	rtldm->thermalvalue_iqk = thermal_value;
-	rtl8821ae_phy_iq_calibrate(hw, false);
+	/* the dm caller already holds lck_inprogress */
+	_rtl8821ae_phy_iq_calibrate_cached(hw);
 }
 
 void rtl8821ae_phy_lc_calibrate(struct ieee80211_hw *hw)
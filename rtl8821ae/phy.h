@@ -249,6 +249,8 @@ bool rtl8821ae_phy_set_rf_power_state(struct ieee80211_hw *hw,
 u8 _rtl8812ae_get_right_chnl_place_for_iqk(u8 chnl);
 void rtl8821ae_phy_set_txpower_level_by_path(struct ieee80211_hw *hw,
 					     u8 channel, u8 path);
+void rtl8821ae_phy_txpwr_cache_invalidate(struct ieee80211_hw *hw);
+void rtl8821ae_phy_txagc_shadow_reset(struct ieee80211_hw *hw);
 void rtl8812ae_do_iqk(struct ieee80211_hw *hw, u8 delta_thermal_index,
 	u8 thermal_value, u8 threshold);
 void rtl8821ae_do_iqk(struct ieee80211_hw *hw, u8 delta_thermal_index,
@@ -201,6 +201,11 @@ int rtl8821ae_init_sw_vars(struct ieee80211_hw *hw)
 		return 1;
 	}
 
+	/* for the TX power index cache, channel switches work without it */
+	rtlpriv->phy.txpwr_cache = vzalloc(RTL_TXPWR_CACHE_LEN *
+					   sizeof(struct rtl_txpwr_agc));
+	rtl8821ae_phy_txpwr_cache_invalidate(hw);
+
 	if (rtlhal->hw_type == HARDWARE_TYPE_RTL8812AE) {
 		fw_name = "rtlwifi/rtl8812aefw.bin";
 		wowlan_fw_name = "rtlwifi/rtl8812aefw_wowlan.bin";
@@ -248,6 +253,10 @@ void rtl8821ae_deinit_sw_vars(struct ieee80211_hw *hw)
 		vfree(rtlpriv->rtlhal.pfirmware);
 		rtlpriv->rtlhal.pfirmware = NULL;
 	}
+	if (rtlpriv->phy.txpwr_cache) {
+		vfree(rtlpriv->phy.txpwr_cache);
+		rtlpriv->phy.txpwr_cache = NULL;
+	}
 #if (USE_SPECIFIC_FW_TO_SUPPORT_WOWLAN == 1)
 	if (rtlpriv->rtlhal.wowlan_firmware) {
 		vfree(rtlpriv->rtlhal.wowlan_firmware);
@@ -320,6 +329,7 @@ static struct rtl_mod_params rtl8821ae_mod_params = {
 	.int_clear = true,
 	.debug = 0,
 	.disable_watchdog = 0,
+	.txpwr_nocache = false,
 };
 
 static const struct rtl_hal_cfg rtl8821ae_hal_cfg = {
@@ -328,6 +338,8 @@ static const struct rtl_hal_cfg rtl8821ae_hal_cfg = {
 	.name = "rtl8821ae_pci",
 	.ops = &rtl8821ae_hal_ops,
 	.mod_params = &rtl8821ae_mod_params,
+	.tx_status_report = true,
+	.hw_int_migration = true,
 	.maps[SYS_ISO_CTRL] = REG_SYS_ISO_CTRL,
 	.maps[SYS_FUNC_EN] = REG_SYS_FUNC_EN,
 	.maps[SYS_CLK] = REG_SYS_CLKR,
@@ -448,6 +460,9 @@ module_param_named(msi, rtl8821ae_mod_params.msi_support, bool, 0444);
 module_param_named(disable_watchdog, rtl8821ae_mod_params.disable_watchdog,
 		   bool, 0444);
 module_param_named(int_clear, rtl8821ae_mod_params.int_clear, bool, 0444);
+/* writable, so that tools/chsw_bench can switch it between runs */
+module_param_named(txpwr_nocache, rtl8821ae_mod_params.txpwr_nocache, bool,
+		   0644);
 MODULE_PARM_DESC(swenc, "Set to 1 for software crypto (default 0)\n");
 MODULE_PARM_DESC(ips, "Set to 0 to not use link power save (default 1)\n");
 MODULE_PARM_DESC(swlps, "Set to 1 to use SW control power save (default 0)\n");
@@ -456,6 +471,7 @@ MODULE_PARM_DESC(msi, "Set to 1 to use MSI interrupts mode (default 1)\n");
 MODULE_PARM_DESC(debug, "Set debug level (0-5) (default 0)");
 MODULE_PARM_DESC(disable_watchdog, "Set to 1 to disable the watchdog (default 0)\n");
 MODULE_PARM_DESC(int_clear, "Set to 0 to disable interrupt clear before set (default 1)\n");
+MODULE_PARM_DESC(txpwr_nocache, "Set to 1 to compute the TX power indexes and write them byte by byte on every channel set, without the cache and the register shadow (default 0)\n");
 
 static SIMPLE_DEV_PM_OPS(rtlwifi_pm_ops, rtl_pci_suspend, rtl_pci_resume);
 
@@ -51,8 +51,22 @@ extern u32 RTL8821AE_AGC_TAB_1TARRAYLEN;
 extern u32 RTL8821AE_AGC_TAB_ARRAY[];
 extern u32 RTL8812AE_AGC_TAB_1TARRAYLEN;
 extern u32 RTL8812AE_AGC_TAB_ARRAY[];
-extern u32 RTL8812AE_TXPWR_LMT_ARRAY_LEN;
-extern u8 *RTL8812AE_TXPWR_LMT[];
-extern u32 RTL8821AE_TXPWR_LMT_ARRAY_LEN;
-extern u8 *RTL8821AE_TXPWR_LMT[];
+extern const s8 RTL8812AE_TXPWR_LMT_2G[MAX_REGULATION_NUM]
+				      [MAX_2_4G_BANDWITH_NUM]
+				      [MAX_RATE_SECTION_NUM]
+				      [CHANNEL_MAX_NUMBER_2G];
+extern const s8 RTL8812AE_TXPWR_LMT_5G[MAX_REGULATION_NUM]
+				      [MAX_5G_BANDWITH_NUM]
+				      [MAX_RATE_SECTION_NUM]
+				      [CHANNEL_MAX_NUMBER_5G];
+extern const s8 RTL8821AE_TXPWR_LMT_2G[MAX_REGULATION_NUM]
+				      [MAX_2_4G_BANDWITH_NUM]
+				      [MAX_RATE_SECTION_NUM]
+				      [CHANNEL_MAX_NUMBER_2G];
+extern const s8 RTL8821AE_TXPWR_LMT_5G[MAX_REGULATION_NUM]
+				      [MAX_5G_BANDWITH_NUM]
+				      [MAX_RATE_SECTION_NUM]
+				      [CHANNEL_MAX_NUMBER_5G];
+extern u32 RTL8821AE_TXPWR_LMT_CHNL_IDX_5G_LEN;
+extern const s8 RTL8821AE_TXPWR_LMT_CHNL_IDX_5G[];
 #endif
@@ -0,0 +1,329 @@
+#!/usr/bin/python3
+#
+# TX power limit tables of rtl8821ae.
+#
+# The vendor ships the limits as text, one row per
+# (regulation, band, bandwidth, rate section, rf path, channel) with the
+# limit in the last column. The driver used to parse those strings at
+# every hardware init. This tool turns them into dense s8 arrays indexed
+# by [regulation][bandwidth][rate section][channel], one per band.
+#
+#	txpwr_lmt.py gen > rtl8821ae/txpwr_lmt.c
+#
+# regenerates the arrays from rtl8821ae/txpwr_lmt_*.txt, and
+#
+#	txpwr_lmt.py check
+#
+# decodes the text tables again the way the old string parser in phy.c
+# did, and compares every entry against rtl8821ae/txpwr_lmt.c. It exits
+# with 1 on any difference.
+#
+# Run from the top of the tree.
+
+import re
+import sys
+
+CHIPS = ('8812AE', '8821AE')
+TXT = 'rtl8821ae/txpwr_lmt_%s.txt'
+OUT = 'rtl8821ae/txpwr_lmt.c'
+CORE = 'core.c'
+
+MAX_REGULATION_NUM = 4
+MAX_2_4G_BANDWITH_NUM = 4
+MAX_5G_BANDWITH_NUM = 4
+MAX_RATE_SECTION_NUM = 6
+CHANNEL_MAX_NUMBER_2G = 14
+CHANNEL_MAX_NUMBER_5G = 49
+MAX_POWER_INDEX = 0x3f
+
+REGULATION = {'FCC': 0, 'MKK': 1, 'ETSI': 2, 'WW13': 3}
+BANDWIDTH = {'20M': 0, '40M': 1, '80M': 2, '160M': 3}
+RATE_SECTION = {('CCK', '1T'): 0, ('CCK', '2T'): 0,
+		('OFDM', '1T'): 1, ('OFDM', '2T'): 1,
+		('HT', '1T'): 2, ('HT', '2T'): 3,
+		('VHT', '1T'): 4, ('VHT', '2T'): 5}
+
+
+def read_rows(chip):
+	rows = []
+	for line in open(TXT % chip.lower()):
+		line = line.strip()
+		if not line or line.startswith('#'):
+			continue
+		row = line.split()
+		if len(row) != 7:
+			sys.exit('%s: bad row: %s' % (TXT % chip.lower(), line))
+		rows.append(row)
+	return rows
+
+
+def read_channel5g():
+	src = open(CORE).read()
+	m = re.search(r'u8 channel5g\[CHANNEL_MAX_NUMBER_5G\] = \{(.*?)\};',
+		      src, re.S)
+	body = re.sub(r'/\*.*?\*/', '', m.group(1), flags=re.S)
+	chnls = [int(c) for c in re.findall(r'\d+', body)]
+	assert len(chnls) == CHANNEL_MAX_NUMBER_5G
+	return chnls
+
+
+def empty(bw_num, chnl_num):
+	return [[[[MAX_POWER_INDEX] * chnl_num
+		  for sec in range(MAX_RATE_SECTION_NUM)]
+		 for bw in range(bw_num)]
+		for regu in range(MAX_REGULATION_NUM)]
+
+
+def compile_rows(rows, channel5g):
+	lmt_2g = empty(MAX_2_4G_BANDWITH_NUM, CHANNEL_MAX_NUMBER_2G)
+	lmt_5g = empty(MAX_5G_BANDWITH_NUM, CHANNEL_MAX_NUMBER_5G)
+
+	for row in rows:
+		regu, band, bw, sec, path, chnl, val = row
+		try:
+			regu = REGULATION[regu]
+			bw = BANDWIDTH[bw]
+			sec = RATE_SECTION[(sec, path)]
+		except KeyError:
+			sys.exit('unknown field in row: %s' % ' '.join(row))
+		chnl = int(chnl)
+		val = min(int(val), MAX_POWER_INDEX)
+
+		if band == '2.4G':
+			if not 1 <= chnl <= CHANNEL_MAX_NUMBER_2G:
+				sys.exit('bad 2.4G channel: %s' % ' '.join(row))
+			lmt, idx = lmt_2g, chnl - 1
+		elif band == '5G':
+			if chnl not in channel5g:
+				sys.exit('bad 5G channel: %s' % ' '.join(row))
+			lmt, idx = lmt_5g, channel5g.index(chnl)
+		else:
+			sys.exit('unknown band: %s' % ' '.join(row))
+
+		lmt[regu][bw][sec][idx] = min(lmt[regu][bw][sec][idx], val)
+
+	return lmt_2g, lmt_5g
+
+
+def emit_array(name, lmt, bw_num, chnl_num):
+	out = []
+	out.append('const s8 %s[MAX_REGULATION_NUM][%s]' % (name, bw_num))
+	out.append('\t\t[MAX_RATE_SECTION_NUM][%s] = {' % chnl_num)
+	for regu in lmt:
+		out.append('\t{')
+		for bw in regu:
+			out.append('\t\t{')
+			for sec in bw:
+				out.append('\t\t\t{ %s },' %
+					   ', '.join('%d' % v for v in sec))
+			out.append('\t\t},')
+		out.append('\t},')
+	out.append('};')
+	out.append('')
+	return out
+
+
+def gen():
+	channel5g = read_channel5g()
+	out = []
+	out.append('/* Generated by tools/txpwr_lmt.py from txpwr_lmt_*.txt,')
+	out.append(' * do not edit. Unset entries are MAX_POWER_INDEX.')
+	out.append(' */')
+	out.append('')
+	out.append('#include "../wifi.h"')
+	out.append('#include "table.h"')
+	out.append('')
+
+	for chip in CHIPS:
+		lmt_2g, lmt_5g = compile_rows(read_rows(chip), channel5g)
+		out += emit_array('RTL%s_TXPWR_LMT_2G' % chip, lmt_2g,
+				  'MAX_2_4G_BANDWITH_NUM',
+				  'CHANNEL_MAX_NUMBER_2G')
+		out += emit_array('RTL%s_TXPWR_LMT_5G' % chip, lmt_5g,
+				  'MAX_5G_BANDWITH_NUM',
+				  'CHANNEL_MAX_NUMBER_5G')
+
+	idx = ['-1'] * (max(channel5g) + 1)
+	for i, chnl in enumerate(channel5g):
+		idx[chnl] = '%d' % i
+	out.append('/* index into channel5g[] by channel number */')
+	out.append('const s8 RTL8821AE_TXPWR_LMT_CHNL_IDX_5G[] = {')
+	for i in range(0, len(idx), 16):
+		out.append('\t%s,' % ', '.join(idx[i:i + 16]))
+	out.append('};')
+	out.append('')
+	out.append('u32 RTL8821AE_TXPWR_LMT_CHNL_IDX_5G_LEN =')
+	out.append('\tsizeof(RTL8821AE_TXPWR_LMT_CHNL_IDX_5G) / sizeof(s8);')
+
+	sys.stdout.write('\n'.join(out) + '\n')
+
+
+# The old parser in phy.c, kept as close to the C as possible so that the
+# check does not share any decoding with gen().
+
+def eq_n_byte(str1, str2, num):
+	if num == 0:
+		return False
+	# the C code reads past the end of a shorter string
+	str1 = str1 + '\0' * num
+	str2 = str2 + '\0' * num
+	while num > 0:
+		num -= 1
+		if str1[num] != str2[num]:
+			return False
+	return True
+
+
+def get_integer_from_string(s):
+	val = 0
+	for c in s:
+		if c < '0' or c > '9':
+			return False, val
+		val = (val * 10 + ord(c) - ord('0')) & 0xff
+	return True, val
+
+
+def s8(v):
+	return v - 256 if v & 0x80 else v
+
+
+def legacy_set_txpower_limit(lmt_2g, lmt_5g, channel5g, row):
+	pregulation, pband, pbandwidth, prate_section, prf_path, \
+		pchannel, ppower_limit = row
+	regulation = bandwidth = rate_section = 0
+
+	ok1, channel = get_integer_from_string(pchannel)
+	ok2, power_limit = get_integer_from_string(ppower_limit)
+	if not ok1 or not ok2:
+		print('illegal entry: %s' % ' '.join(row))
+	power_limit = s8(power_limit)
+
+	if power_limit > MAX_POWER_INDEX:
+		power_limit = MAX_POWER_INDEX
+
+	if eq_n_byte(pregulation, 'FCC', 3):
+		regulation = 0
+	elif eq_n_byte(pregulation, 'MKK', 3):
+		regulation = 1
+	elif eq_n_byte(pregulation, 'ETSI', 4):
+		regulation = 2
+	elif eq_n_byte(pregulation, 'WW13', 4):
+		regulation = 3
+
+	if eq_n_byte(prate_section, 'CCK', 3):
+		rate_section = 0
+	elif eq_n_byte(prate_section, 'OFDM', 4):
+		rate_section = 1
+	elif eq_n_byte(prate_section, 'HT', 2) and \
+	     eq_n_byte(prf_path, '1T', 2):
+		rate_section = 2
+	elif eq_n_byte(prate_section, 'HT', 2) and \
+	     eq_n_byte(prf_path, '2T', 2):
+		rate_section = 3
+	elif eq_n_byte(prate_section, 'VHT', 3) and \
+	     eq_n_byte(prf_path, '1T', 2):
+		rate_section = 4
+	elif eq_n_byte(prate_section, 'VHT', 3) and \
+	     eq_n_byte(prf_path, '2T', 2):
+		rate_section = 5
+
+	if eq_n_byte(pbandwidth, '20M', 3):
+		bandwidth = 0
+	elif eq_n_byte(pbandwidth, '40M', 3):
+		bandwidth = 1
+	elif eq_n_byte(pbandwidth, '80M', 3):
+		bandwidth = 2
+	elif eq_n_byte(pbandwidth, '160M', 4):
+		bandwidth = 3
+
+	if eq_n_byte(pband, '2.4G', 4):
+		channel_index = channel - 1
+		if channel_index == -1:
+			return
+		if channel_index >= CHANNEL_MAX_NUMBER_2G:
+			print('2.4G channel out of the table: %s' % ' '.join(row))
+			return
+		lmt = lmt_2g
+	elif eq_n_byte(pband, '5G', 2):
+		channel_index = -1
+		for i in range(len(channel5g)):
+			if channel5g[i] == channel:
+				channel_index = i
+		if channel_index == -1:
+			return
+		lmt = lmt_5g
+	else:
+		return
+
+	if power_limit < lmt[regulation][bandwidth][rate_section][channel_index]:
+		lmt[regulation][bandwidth][rate_section][channel_index] = \
+			power_limit
+
+
+def parse_array(src, name):
+	m = re.search(r'const s8 %s\[[^=]*= \{(.*?)\n\};' % name, src, re.S)
+	if not m:
+		sys.exit('%s not found in %s' % (name, OUT))
+	return [int(v) for v in re.findall(r'-?\d+', m.group(1))]
+
+
+def flatten(lmt):
+	return [v for regu in lmt for bw in regu for sec in bw for v in sec]
+
+
+def check():
+	channel5g = read_channel5g()
+	src = open(OUT).read()
+	bad = 0
+
+	for chip in CHIPS:
+		rows = read_rows(chip)
+		lmt_2g = empty(MAX_2_4G_BANDWITH_NUM, CHANNEL_MAX_NUMBER_2G)
+		lmt_5g = empty(MAX_5G_BANDWITH_NUM, CHANNEL_MAX_NUMBER_5G)
+		for row in rows:
+			legacy_set_txpower_limit(lmt_2g, lmt_5g, channel5g, row)
+
+		for band, lmt in (('2G', lmt_2g), ('5G', lmt_5g)):
+			name = 'RTL%s_TXPWR_LMT_%s' % (chip, band)
+			want = flatten(lmt)
+			got = parse_array(src, name)
+			if len(want) != len(got):
+				print('%s: %d entries, expected %d' %
+				      (name, len(got), len(want)))
+				bad += 1
+				continue
+			diff = [i for i in range(len(want))
+				if want[i] != got[i]]
+			for i in diff:
+				print('%s: entry %d is %d, expected %d' %
+				      (name, i, got[i], want[i]))
+			bad += len(diff)
+			print('%s: %d rows, %d entries, %d set, %d differ' %
+			      (name, len(rows), len(want),
+			       len([v for v in want if v != MAX_POWER_INDEX]),
+			       len(diff)))
+
+	idx = parse_array(src, 'RTL8821AE_TXPWR_LMT_CHNL_IDX_5G')
+	for chnl in range(len(idx)):
+		want = channel5g.index(chnl) if chnl in channel5g else -1
+		if idx[chnl] != want:
+			print('channel index of %d is %d, expected %d' %
+			      (chnl, idx[chnl], want))
+			bad += 1
+	for chnl in channel5g:
+		if chnl >= len(idx):
+			print('channel %d missing from the index' % chnl)
+			bad += 1
+
+	if bad:
+		sys.exit(1)
+	print('binary tables match the text tables')
+
+
+if len(sys.argv) != 2 or sys.argv[1] not in ('gen', 'check'):
+	sys.exit('usage: %s gen|check' % sys.argv[0])
+
+if sys.argv[1] == 'gen':
+	gen()
+else:
+	check()
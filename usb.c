@@ -40,6 +40,18 @@ MODULE_AUTHOR("Larry Finger	<Larry.FInger@lwfinger.net>");
 MODULE_LICENSE("GPL");
 MODULE_DESCRIPTION("USB basic driver for rtlwifi");
 
+static int rtl_usb_tx_agg = RTL_USB_TX_AGG_MAX_NUM;
+module_param_named(txagg, rtl_usb_tx_agg, int, 0444);
+MODULE_PARM_DESC(txagg, "Max frames per bulk-OUT transfer, 1 to disable TX aggregation (default: chip limit)\n");
+
+static uint rtl_usb_tx_agg_timeout = 200;
+module_param_named(txagg_timeout, rtl_usb_tx_agg_timeout, uint, 0644);
+MODULE_PARM_DESC(txagg_timeout, "Usec a partial TX aggregate waits for more frames (default 200)\n");
+
+static bool rtl_usb_io_batch = true;
+module_param_named(io_batch, rtl_usb_io_batch, bool, 0644);
+MODULE_PARM_DESC(io_batch, "Combine adjacent register writes of table loaders (default 1)\n");
+
 #define	REALTEK_USB_VENQT_READ			0xC0
 #define	REALTEK_USB_VENQT_WRITE			0x40
 #define REALTEK_USB_VENQT_CMD_REQ		0x05
@@ -47,17 +59,124 @@ MODULE_DESCRIPTION("USB basic driver for rtlwifi");
 
 #define MAX_USBCTRL_VENDORREQ_TIMES		10
 
+static void _rtl_usb_tx_flow_update(struct ieee80211_hw *hw);
+
+static struct urb *_rtl_usb_urb_pool_get(struct rtl_usb_urb_pool *pool)
+{
+	struct urb *urb = NULL;
+	unsigned long flags;
+	bool stopped = false;
+
+	/* not set up yet, still probing */
+	if (!pool->urbs)
+		return NULL;
+
+	spin_lock_irqsave(&pool->lock, flags);
+	pool->gets++;
+	if (pool->free) {
+		urb = pool->urbs[--pool->free];
+		if (pool->free < pool->min_free)
+			pool->min_free = pool->free;
+	} else {
+		pool->misses++;
+		if (pool->hw && !pool->stopped) {
+			pool->stopped = true;
+			pool->stalls++;
+			stopped = true;
+		}
+	}
+	spin_unlock_irqrestore(&pool->lock, flags);
+
+	if (stopped)
+		_rtl_usb_tx_flow_update(pool->hw);
+
+	return urb;
+}
+
+static void _rtl_usb_urb_pool_put(struct rtl_usb_urb_pool *pool,
+				  struct urb *urb)
+{
+	unsigned long flags;
+	bool woken = false;
+
+	spin_lock_irqsave(&pool->lock, flags);
+	pool->urbs[pool->free++] = urb;
+	if (pool->stopped && pool->free >= pool->size / 4) {
+		pool->stopped = false;
+		woken = true;
+	}
+	spin_unlock_irqrestore(&pool->lock, flags);
+
+	if (woken)
+		_rtl_usb_tx_flow_update(pool->hw);
+}
+
+static int _rtl_usb_urb_pool_init(struct rtl_usb_urb_pool *pool, u16 size,
+				  struct ieee80211_hw *hw)
+{
+	u16 i;
+
+	spin_lock_init(&pool->lock);
+	pool->urbs = kcalloc(size, sizeof(*pool->urbs), GFP_KERNEL);
+	if (!pool->urbs)
+		return -ENOMEM;
+
+	for (i = 0; i < size; i++) {
+		pool->urbs[i] = usb_alloc_urb(0, GFP_KERNEL);
+		if (!pool->urbs[i])
+			goto err_out;
+	}
+	pool->hw = hw;
+	pool->size = size;
+	pool->free = size;
+	pool->min_free = size;
+	return 0;
+
+err_out:
+	while (i--)
+		usb_free_urb(pool->urbs[i]);
+	kfree(pool->urbs);
+	pool->urbs = NULL;
+	return -ENOMEM;
+}
+
+/* all URBs of the pool must be back */
+static void _rtl_usb_urb_pool_deinit(struct rtl_usb_urb_pool *pool)
+{
+	u16 i;
+
+	if (!pool->urbs)
+		return;
+
+	WARN_ON(pool->free != pool->size);
+	for (i = 0; i < pool->free; i++)
+		usb_free_urb(pool->urbs[i]);
+	kfree(pool->urbs);
+	pool->urbs = NULL;
+}
+
 static void usbctrl_async_callback(struct urb *urb)
 {
-	if (urb) {
-		/* free dr */
-		kfree(urb->setup_packet);
-		/* free databuf */
-		kfree(urb->transfer_buffer);
+	struct rtl_usb *rtlusb = urb->context;
+
+	/* pooled URBs keep their buffers */
+	if (rtlusb) {
+		_rtl_usb_urb_pool_put(&rtlusb->ctrl_urb_pool, urb);
+		return;
 	}
+
+	/* free dr */
+	kfree(urb->setup_packet);
+	/* free databuf */
+	kfree(urb->transfer_buffer);
 }
 
-static int _usbctrl_vendorreq_async_write(struct usb_device *udev, u8 request,
+/* Takes a URB with its buffers from the control pool. Writes issued before
+ * the pool exists, or while it is empty, allocate their own; these may be
+ * in atomic context and have no way to wait for a free URB.
+ */
+static int _usbctrl_vendorreq_async_write(struct rtl_usb *rtlusb,
+					  struct usb_device *udev, u8 request,
 					  u16 value, u16 index, void *pdata,
 					  u16 len)
 {
@@ -75,21 +194,30 @@ static int _usbctrl_vendorreq_async_write(struct usb_device *udev, u8 request,
 	pipe = usb_sndctrlpipe(udev, 0); /* write_out */
 	reqtype =  REALTEK_USB_VENQT_WRITE;
 
-	dr = kzalloc(sizeof(*dr), GFP_ATOMIC);
-	if (!dr)
-		return -ENOMEM;
+	rtlusb->io_ctrl_writes++;
+	urb = _rtl_usb_urb_pool_get(&rtlusb->ctrl_urb_pool);
+	if (urb) {
+		dr = (struct usb_ctrlrequest *)urb->setup_packet;
+		databuf = urb->transfer_buffer;
+	} else {
+		rtlusb = NULL;
 
-	databuf = kzalloc(databuf_maxlen, GFP_ATOMIC);
-	if (!databuf) {
-		kfree(dr);
-		return -ENOMEM;
-	}
+		dr = kzalloc(sizeof(*dr), GFP_ATOMIC);
+		if (!dr)
+			return -ENOMEM;
 
-	urb = usb_alloc_urb(0, GFP_ATOMIC);
-	if (!urb) {
-		kfree(databuf);
-		kfree(dr);
-		return -ENOMEM;
+		databuf = kzalloc(databuf_maxlen, GFP_ATOMIC);
+		if (!databuf) {
+			kfree(dr);
+			return -ENOMEM;
+		}
+
+		urb = usb_alloc_urb(0, GFP_ATOMIC);
+		if (!urb) {
+			kfree(databuf);
+			kfree(dr);
+			return -ENOMEM;
+		}
 	}
 
 	dr->bRequestType = reqtype;
@@ -101,7 +229,18 @@ static int _usbctrl_vendorreq_async_write(struct usb_device *udev, u8 request,
 	memcpy(databuf, pdata, len);
 	usb_fill_control_urb(urb, udev, pipe,
 			     (unsigned char *)dr, databuf, len,
-			     usbctrl_async_callback, NULL);
+			     usbctrl_async_callback, rtlusb);
+
+	if (rtlusb) {
+		usb_anchor_urb(urb, &rtlusb->ctrl_submitted);
+		rc = usb_submit_urb(urb, GFP_ATOMIC);
+		if (rc < 0) {
+			usb_unanchor_urb(urb);
+			_rtl_usb_urb_pool_put(&rtlusb->ctrl_urb_pool, urb);
+		}
+		return rc;
+	}
+
 	rc = usb_submit_urb(urb, GFP_ATOMIC);
 	if (rc < 0) {
 		kfree(databuf);
@@ -143,8 +282,11 @@ static int _usbctrl_vendorreq_sync_read(struct usb_device *udev, u8 request,
 	return status;
 }
 
+static void _usb_batch_flush(struct rtl_priv *rtlpriv);
+
 static u32 _usb_read_sync(struct rtl_priv *rtlpriv, u32 addr, u16 len)
 {
+	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(rtlpriv->hw));
 	struct device *dev = rtlpriv->io.dev;
 	struct usb_device *udev = to_usb_device(dev);
 	u8 request;
@@ -161,6 +303,9 @@ static u32 _usb_read_sync(struct rtl_priv *rtlpriv, u32 addr, u16 len)
 	request = REALTEK_USB_VENQT_CMD_REQ;
 	index = REALTEK_USB_VENQT_CMD_IDX; /* n/a */
 
+	_usb_batch_flush(rtlpriv);
+	rtlusb->io_ctrl_reads++;
+
 	wvalue = (u16)addr;
 	_usbctrl_vendorreq_sync_read(udev, request, wvalue, index, data, len);
 	return le32_to_cpu(*data);
@@ -181,41 +326,103 @@ static u32 _usb_read32_sync(struct rtl_priv *rtlpriv, u32 addr)
 	return _usb_read_sync(rtlpriv, addr, 4);
 }
 
-static void _usb_write_async(struct usb_device *udev, u32 addr, u32 val,
+static void _usb_write_async(struct rtl_priv *rtlpriv, u32 addr, u32 val,
 			     u16 len)
 {
+	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(rtlpriv->hw));
+	struct usb_device *udev = to_usb_device(rtlpriv->io.dev);
 	u8 request;
 	u16 wvalue;
 	u16 index;
 	__le32 data;
 
+	data = cpu_to_le32(val);
+	rtlusb->io_reg_writes++;
+	if (READ_ONCE(rtlusb->io_batch_owner) == current && !in_interrupt()) {
+		/* only what continues the batch is held back */
+		if (rtlusb->io_batch_len &&
+		    (addr != rtlusb->io_batch_addr + rtlusb->io_batch_len ||
+		     rtlusb->io_batch_len + len > sizeof(rtlusb->io_batch_buf)))
+			_usb_batch_flush(rtlpriv);
+		if (!rtlusb->io_batch_len)
+			rtlusb->io_batch_addr = addr;
+		memcpy(rtlusb->io_batch_buf + rtlusb->io_batch_len, &data, len);
+		rtlusb->io_batch_len += len;
+		return;
+	}
+
 	request = REALTEK_USB_VENQT_CMD_REQ;
 	index = REALTEK_USB_VENQT_CMD_IDX; /* n/a */
 	wvalue = (u16)(addr&0x0000ffff);
-	data = cpu_to_le32(val);
-	_usbctrl_vendorreq_async_write(udev, request, wvalue, index, &data,
-				       len);
+	_usbctrl_vendorreq_async_write(rtlusb, udev, request, wvalue, index,
+				       &data, len);
 }
 
-static void _usb_write8_async(struct rtl_priv *rtlpriv, u32 addr, u8 val)
+/* Sends the writes held back so far as one vendor request. It goes out
+ * asynchronously like a single write; the control endpoint keeps it in
+ * order with later reads and writes.
+ */
+static void _usb_batch_flush(struct rtl_priv *rtlpriv)
 {
-	struct device *dev = rtlpriv->io.dev;
+	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(rtlpriv->hw));
+	struct usb_device *udev = to_usb_device(rtlpriv->io.dev);
+
+	if (READ_ONCE(rtlusb->io_batch_owner) != current ||
+	    !rtlusb->io_batch_len)
+		return;
 
-	_usb_write_async(to_usb_device(dev), addr, val, 1);
+	_usbctrl_vendorreq_async_write(rtlusb, udev, REALTEK_USB_VENQT_CMD_REQ,
+				       (u16)(rtlusb->io_batch_addr & 0xffff),
+				       REALTEK_USB_VENQT_CMD_IDX,
+				       rtlusb->io_batch_buf,
+				       rtlusb->io_batch_len);
+	rtlusb->io_batch_len = 0;
 }
 
-static void _usb_write16_async(struct rtl_priv *rtlpriv, u32 addr, u16 val)
+/* Only one task batches at a time, writes of any other context go out as
+ * before. The owner is taken with cmpxchg(), the depth and the buffer are
+ * only touched by the owner. Must not be called from interrupt context.
+ */
+static void _usb_batch_begin(struct rtl_priv *rtlpriv)
 {
-	struct device *dev = rtlpriv->io.dev;
+	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(rtlpriv->hw));
+	struct task_struct *owner;
 
-	_usb_write_async(to_usb_device(dev), addr, val, 2);
+	if (!rtl_usb_io_batch)
+		return;
+
+	owner = cmpxchg(&rtlusb->io_batch_owner, NULL, current);
+	if (!owner || owner == current)
+		rtlusb->io_batch_depth++;
 }
 
-static void _usb_write32_async(struct rtl_priv *rtlpriv, u32 addr, u32 val)
+static void _usb_batch_end(struct rtl_priv *rtlpriv)
 {
-	struct device *dev = rtlpriv->io.dev;
+	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(rtlpriv->hw));
+
+	if (READ_ONCE(rtlusb->io_batch_owner) != current)
+		return;
+
+	if (--rtlusb->io_batch_depth == 0) {
+		_usb_batch_flush(rtlpriv);
+		/* the buffer is empty before another task can take it */
+		smp_store_release(&rtlusb->io_batch_owner, NULL);
+	}
+}
+
+static void _usb_write8_async(struct rtl_priv *rtlpriv, u32 addr, u8 val)
+{
+	_usb_write_async(rtlpriv, addr, val, 1);
+}
+
+static void _usb_write16_async(struct rtl_priv *rtlpriv, u32 addr, u16 val)
+{
+	_usb_write_async(rtlpriv, addr, val, 2);
+}
 
-	_usb_write_async(to_usb_device(dev), addr, val, 4);
+static void _usb_write32_async(struct rtl_priv *rtlpriv, u32 addr, u32 val)
+{
+	_usb_write_async(rtlpriv, addr, val, 4);
 }
 
 static void _usb_writeN_sync(struct rtl_priv *rtlpriv, u32 addr, void *data,
@@ -234,6 +441,8 @@ static void _usb_writeN_sync(struct rtl_priv *rtlpriv, u32 addr, void *data,
 	buffer = kmemdup(data, len, GFP_ATOMIC);
 	if (!buffer)
 		return;
+	_usb_batch_flush(rtlpriv);
+	rtl_usbdev(rtl_usbpriv(rtlpriv->hw))->io_ctrl_writes++;
 	usb_control_msg(udev, pipe, request, reqtype, wvalue,
 			index, buffer, len, 50);
 
@@ -254,6 +463,9 @@ static void _rtl_usb_io_handler_init(struct device *dev,
 	rtlpriv->io.read16_sync		= _usb_read16_sync;
 	rtlpriv->io.read32_sync		= _usb_read32_sync;
 	rtlpriv->io.writeN_sync		= _usb_writeN_sync;
+	rtlpriv->io.batch_begin		= _usb_batch_begin;
+	rtlpriv->io.batch_flush		= _usb_batch_flush;
+	rtlpriv->io.batch_end		= _usb_batch_end;
 }
 
 static void _rtl_usb_io_handler_release(struct ieee80211_hw *hw)
@@ -263,24 +475,18 @@ static void _rtl_usb_io_handler_release(struct ieee80211_hw *hw)
 	mutex_destroy(&rtlpriv->io.bb_mutex);
 }
 
-/**
- *
- *	Default aggregation handler. Do nothing and just return the oldest skb.
- */
-static struct sk_buff *_none_usb_tx_aggregate_hdl(struct ieee80211_hw *hw,
-						  struct sk_buff_head *list)
-{
-	return skb_dequeue(list);
-}
-
 #define IS_HIGH_SPEED_USB(udev) \
 		((USB_SPEED_HIGH == (udev)->speed) ? true : false)
 
+static enum hrtimer_restart _rtl_usb_tx_agg_timer_callback(struct hrtimer *timer);
+static void _rtl_usb_tx_agg_work(unsigned long param);
+
 static int _rtl_usb_init_tx(struct ieee80211_hw *hw)
 {
 	u32 i;
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+	struct rtl_hal_usbint_cfg *cfg = rtlpriv->cfg->usb_interface_cfg;
 
 	rtlusb->max_bulk_out_size = IS_HIGH_SPEED_USB(rtlusb->udev)
 						    ? USB_HIGH_SPEED_BULK_SIZE
@@ -302,15 +508,40 @@ static int _rtl_usb_init_tx(struct ieee80211_hw *hw)
 		 rtlpriv->cfg->usb_interface_cfg->usb_tx_post_hdl;
 	rtlusb->usb_tx_cleanup	=
 		 rtlpriv->cfg->usb_interface_cfg->usb_tx_cleanup;
-	rtlusb->usb_tx_aggregate_hdl =
-		 (rtlpriv->cfg->usb_interface_cfg->usb_tx_aggregate_hdl)
-		 ? rtlpriv->cfg->usb_interface_cfg->usb_tx_aggregate_hdl
-		 : &_none_usb_tx_aggregate_hdl;
+	rtlusb->usb_tx_aggregate_hdl = cfg->usb_tx_aggregate_hdl;
+
+	/* the chip has to be told how many frames share a bulk-OUT */
+	rtlusb->tx_agg_num = 1;
+	if (rtlusb->usb_tx_aggregate_hdl && cfg->tx_agg_num > 1)
+		rtlusb->tx_agg_num = clamp(rtl_usb_tx_agg, 1,
+					   (int)min_t(u8, cfg->tx_agg_num,
+						      RTL_USB_TX_AGG_MAX_NUM));
+	rtlusb->tx_agg_size = cfg->tx_agg_size;
+	RT_TRACE(rtlpriv, COMP_INIT, DBG_DMESG,
+		 "USB TX aggregation: %d frames, %d bytes\n",
+		 rtlusb->tx_agg_num, rtlusb->tx_agg_size);
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 13, 0)
+	hrtimer_setup(&rtlusb->tx_agg_timer, _rtl_usb_tx_agg_timer_callback,
+		      CLOCK_MONOTONIC, HRTIMER_MODE_REL);
+#else
+	hrtimer_init(&rtlusb->tx_agg_timer, CLOCK_MONOTONIC, HRTIMER_MODE_REL);
+	rtlusb->tx_agg_timer.function = _rtl_usb_tx_agg_timer_callback;
+#endif
+	tasklet_init(&rtlusb->tx_agg_tasklet, _rtl_usb_tx_agg_work,
+		     (unsigned long)rtlusb);
+
+	spin_lock_init(&rtlusb->tx_flow_lock);
+	rtlusb->tx_ep_stopped = 0;
+	rtlusb->tx_queues_stopped = 0;
 
 	init_usb_anchor(&rtlusb->tx_submitted);
 	for (i = 0; i < RTL_USB_MAX_EP_NUM; i++) {
 		skb_queue_head_init(&rtlusb->tx_skb_queue[i]);
 		init_usb_anchor(&rtlusb->tx_pending[i]);
+		atomic_set(&rtlusb->tx_inflight[i], 0);
+		atomic_set(&rtlusb->tx_inflight_bytes[i], 0);
+		rtlusb->tx_agg_bytes[i] = 0;
 	}
 	return 0;
 }
@@ -342,6 +573,8 @@ static int _rtl_usb_init_rx(struct ieee80211_hw *hw)
 	return 0;
 }
 
+static int _rtl_usb_init_pools(struct ieee80211_hw *hw);
+
 static int _rtl_usb_init(struct ieee80211_hw *hw)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
@@ -380,6 +613,8 @@ static int _rtl_usb_init(struct ieee80211_hw *hw)
 	rtlusb->usb_mq_to_hwq =  rtlpriv->cfg->usb_interface_cfg->usb_mq_to_hwq;
 	_rtl_usb_init_tx(hw);
 	_rtl_usb_init_rx(hw);
+	if (!err)
+		err = _rtl_usb_init_pools(hw);
 	return err;
 }
 
@@ -442,46 +677,157 @@ static int _rtl_prep_rx_urb(struct ieee80211_hw *hw, struct rtl_usb *rtlusb,
 	return 0;
 }
 
-static void _rtl_usb_rx_process_agg(struct ieee80211_hw *hw,
-				    struct sk_buff *skb)
+/* all aggregates must be back */
+static void _rtl_usb_tx_agg_bufs_deinit(struct rtl_usb *rtlusb)
 {
-	struct rtl_priv *rtlpriv = rtl_priv(hw);
-	u8 *rxdesc = skb->data;
-	struct ieee80211_hdr *hdr;
-	bool unicast = false;
-	__le16 fc;
-	struct ieee80211_rx_status rx_status = {0};
-	struct rtl_stats stats = {
-		.signal = 0,
-		.rate = 0,
-	};
+	u32 ep_num;
+	u8 i;
+
+	for (ep_num = 0; ep_num < RTL_USB_MAX_EP_NUM; ep_num++) {
+		WARN_ON(rtlusb->tx_agg_buf_free[ep_num] !=
+			rtlusb->tx_agg_buf_num[ep_num]);
+		for (i = 0; i < rtlusb->tx_agg_buf_free[ep_num]; i++)
+			dev_kfree_skb(rtlusb->tx_agg_bufs[ep_num][i]);
+		rtlusb->tx_agg_buf_num[ep_num] = 0;
+		rtlusb->tx_agg_buf_free[ep_num] = 0;
+	}
+}
 
-	skb_pull(skb, RTL_RX_DESC_SIZE);
-	rtlpriv->cfg->ops->query_rx_desc(hw, &stats, &rx_status, rxdesc, skb);
-	skb_pull(skb, (stats.rx_drvinfo_size + stats.rx_bufshift));
-	hdr = (struct ieee80211_hdr *)(skb->data);
-	fc = hdr->frame_control;
-	if (!stats.crc) {
-		memcpy(IEEE80211_SKB_RXCB(skb), &rx_status, sizeof(rx_status));
+/* Each endpoint an AC queue maps to gets as many aggregate buffers of
+ * tx_agg_size as it may have bulk-OUTs in flight, so aggregates never
+ * need an allocation, which would be of order 3.
+ */
+static int _rtl_usb_tx_agg_bufs_init(struct rtl_usb *rtlusb)
+{
+	struct sk_buff *skb;
+	u32 ep_num;
+	int q;
 
-		if (is_broadcast_ether_addr(hdr->addr1)) {
-			/*TODO*/;
-		} else if (is_multicast_ether_addr(hdr->addr1)) {
-			/*TODO*/
-		} else {
-			unicast = true;
-			rtlpriv->stats.rxbytesunicast +=  skb->len;
+	spin_lock_init(&rtlusb->tx_agg_buf_lock);
+	if (rtlusb->tx_agg_num <= 1)
+		return 0;
+
+	for (q = RTL_TXQ_BK; q <= RTL_TXQ_VO; q++) {
+		ep_num = rtlusb->ep_map.ep_mapping[q];
+		if (ep_num >= RTL_USB_MAX_EP_NUM)
+			return -EINVAL;
+		while (rtlusb->tx_agg_buf_num[ep_num] < RTL_USB_TX_AGG_BUFS) {
+			skb = dev_alloc_skb(rtlusb->tx_agg_size);
+			if (!skb)
+				return -ENOMEM;
+			rtlusb->tx_agg_bufs[ep_num][rtlusb->tx_agg_buf_num[ep_num]++] =
+				skb;
+			rtlusb->tx_agg_buf_free[ep_num]++;
 		}
+	}
+	return 0;
+}
 
-		if (ieee80211_is_data(fc)) {
-			rtlpriv->cfg->ops->led_control(hw, LED_CTL_RX);
+static struct sk_buff *_rtl_usb_tx_agg_buf_get(struct rtl_usb *rtlusb,
+					       u32 ep_num)
+{
+	struct sk_buff *skb = NULL;
+	unsigned long flags;
 
-			if (unicast)
-				rtlpriv->link_info.num_rx_inperiod++;
+	spin_lock_irqsave(&rtlusb->tx_agg_buf_lock, flags);
+	if (rtlusb->tx_agg_buf_free[ep_num])
+		skb = rtlusb->tx_agg_bufs[ep_num]
+				[--rtlusb->tx_agg_buf_free[ep_num]];
+	else
+		rtlusb->tx_agg_buf_misses++;
+	spin_unlock_irqrestore(&rtlusb->tx_agg_buf_lock, flags);
+
+	if (skb)
+		skb_trim(skb, 0);
+	return skb;
+}
+
+static void _rtl_usb_tx_agg_buf_put(struct rtl_usb *rtlusb, u32 ep_num,
+				    struct sk_buff *skb)
+{
+	unsigned long flags;
+
+	spin_lock_irqsave(&rtlusb->tx_agg_buf_lock, flags);
+	rtlusb->tx_agg_bufs[ep_num][rtlusb->tx_agg_buf_free[ep_num]++] = skb;
+	spin_unlock_irqrestore(&rtlusb->tx_agg_buf_lock, flags);
+}
+
+static void _rtl_usb_deinit_pools(struct ieee80211_hw *hw)
+{
+	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+	struct urb *urb;
+
+	while ((urb = usb_get_from_anchor(&rtlusb->rx_cleanup_urbs))) {
+		usb_free_coherent(urb->dev, urb->transfer_buffer_length,
+				urb->transfer_buffer, urb->transfer_dma);
+		usb_free_urb(urb);
+	}
+
+	_rtl_usb_urb_pool_deinit(&rtlusb->tx_urb_pool);
+	_rtl_usb_urb_pool_deinit(&rtlusb->ctrl_urb_pool);
+	kfree(rtlusb->ctrl_bufs);
+	rtlusb->ctrl_bufs = NULL;
+	_rtl_usb_tx_agg_bufs_deinit(rtlusb);
+}
+
+/* Everything the data path and the async register writes need is allocated
+ * here once and reused until disconnect: the bulk-IN URBs with their
+ * buffers, the bulk-OUT URBs and aggregate buffers and the control URBs
+ * with their setup packet and data buffer.
+ */
+static int _rtl_usb_init_pools(struct ieee80211_hw *hw)
+{
+	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+	struct rtl_usb_urb_pool *ctrl = &rtlusb->ctrl_urb_pool;
+	struct urb *urb;
+	int err;
+	u32 i;
+
+	for (i = 0; i < rtlusb->rx_urb_num; i++) {
+		err = -ENOMEM;
+		urb = usb_alloc_urb(0, GFP_KERNEL);
+		if (!urb)
+			goto err_out;
+
+		err = _rtl_prep_rx_urb(hw, rtlusb, urb, GFP_KERNEL);
+		if (err < 0) {
+			pr_err("Failed to prep_rx_urb!!\n");
+			usb_free_urb(urb);
+			goto err_out;
 		}
-		/* static bcn for roaming */
-		rtl_beacon_statistic(hw, skb);
+		usb_anchor_urb(urb, &rtlusb->rx_cleanup_urbs);
+		usb_free_urb(urb);
+	}
+
+	err = _rtl_usb_urb_pool_init(&rtlusb->tx_urb_pool,
+				     RTL_USB_TX_URB_POOL_SIZE, hw);
+	if (err)
+		goto err_out;
+
+	err = _rtl_usb_tx_agg_bufs_init(rtlusb);
+	if (err)
+		goto err_out;
+
+	err = -ENOMEM;
+	rtlusb->ctrl_bufs = kcalloc(RTL_USB_CTRL_URB_POOL_SIZE,
+				    sizeof(*rtlusb->ctrl_bufs), GFP_KERNEL);
+	if (!rtlusb->ctrl_bufs)
+		goto err_out;
+
+	init_usb_anchor(&rtlusb->ctrl_submitted);
+	err = _rtl_usb_urb_pool_init(ctrl, RTL_USB_CTRL_URB_POOL_SIZE, NULL);
+	if (err)
+		goto err_out;
+	for (i = 0; i < ctrl->size; i++) {
+		ctrl->urbs[i]->setup_packet =
+			(unsigned char *)&rtlusb->ctrl_bufs[i].dr;
+		ctrl->urbs[i]->transfer_buffer = rtlusb->ctrl_bufs[i].data;
 	}
+	return 0;
+
+err_out:
+	_rtl_usb_deinit_pools(hw);
+	return err;
 }
 
 static void _rtl_usb_rx_process_noagg(struct ieee80211_hw *hw,
@@ -493,6 +839,7 @@ static void _rtl_usb_rx_process_noagg(struct ieee80211_hw *hw,
 	bool unicast = false;
 	__le16 fc;
 	struct ieee80211_rx_status rx_status = {0};
+	struct rtl_rx_mgmt rx_mgmt;
 	struct rtl_stats stats = {
 		.signal = 0,
 		.rate = 0,
@@ -512,18 +859,21 @@ static void _rtl_usb_rx_process_noagg(struct ieee80211_hw *hw,
 			/*TODO*/
 		} else {
 			unicast = true;
-			rtlpriv->stats.rxbytesunicast +=  skb->len;
+			rtl_data_stats_add(rtlpriv, rx_bytes_unicast,
+					   skb->len);
 		}
 
 		if (ieee80211_is_data(fc)) {
 			rtlpriv->cfg->ops->led_control(hw, LED_CTL_RX);
 
 			if (unicast)
-				rtlpriv->link_info.num_rx_inperiod++;
+				rtl_traffic_rx(hw, skb);
 		}
 
-		/* static bcn for roaming */
-		rtl_beacon_statistic(hw, skb);
+		/* static bcn for roaming, which needs no elements */
+		rtl_parse_rx_mgmt(hw, skb, &rx_mgmt, false);
+		rtl_beacon_statistic(hw, &rx_mgmt);
+		rtl_rx_mgmt_done(hw, &rx_mgmt);
 
 		if (likely(rtl_action_proc(hw, skb, false)))
 			ieee80211_rx(hw, skb);
@@ -539,16 +889,18 @@ static void _rtl_rx_pre_process(struct ieee80211_hw *hw, struct sk_buff *skb)
 	struct sk_buff *_skb;
 	struct sk_buff_head rx_queue;
 	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+	u32 frames;
 
-	skb_queue_head_init(&rx_queue);
-	if (rtlusb->usb_rx_segregate_hdl)
-		rtlusb->usb_rx_segregate_hdl(hw, skb, &rx_queue);
-	WARN_ON(skb_queue_empty(&rx_queue));
-	while (!skb_queue_empty(&rx_queue)) {
-		_skb = skb_dequeue(&rx_queue);
-		_rtl_usb_rx_process_agg(hw, _skb);
-		ieee80211_rx(hw, _skb);
-	}
+	__skb_queue_head_init(&rx_queue);
+	rtlusb->usb_rx_segregate_hdl(hw, skb, &rx_queue);
+
+	frames = skb_queue_len(&rx_queue);
+	rtlusb->rx_agg_urbs++;
+	rtlusb->rx_agg_frames += frames;
+	rtlusb->rx_agg_hist[min_t(u32, frames, RTL_USB_RX_AGG_HIST_SIZE - 1)]++;
+
+	while ((_skb = __skb_dequeue(&rx_queue)))
+		_rtl_usb_rx_process_noagg(hw, _skb);
 }
 
 #define __RX_SKB_MAX_QUEUED	96
@@ -565,13 +917,10 @@ static void _rtl_rx_work(unsigned long param)
 			continue;
 		}
 
-		if (likely(!rtlusb->usb_rx_segregate_hdl)) {
+		if (!rtlusb->usb_rx_segregate_hdl)
 			_rtl_usb_rx_process_noagg(hw, skb);
-		} else {
-			/* TO DO */
+		else
 			_rtl_rx_pre_process(hw, skb);
-			pr_err("rx agg not supported\n");
-		}
 	}
 }
 
@@ -612,6 +961,32 @@ static unsigned int _rtl_rx_get_padding(struct ieee80211_hdr *hdr,
 
 #define __RADIO_TAP_SIZE_RSV	32
 
+/* Copies a frame of len bytes whose 802.11 header starts hdr_off bytes
+ * into data to an skb of its own, with the payload 4 byte aligned and
+ * room for mac80211's radiotap in front.
+ */
+struct sk_buff *rtl_usb_rx_copy_frame(struct ieee80211_hw *hw, const u8 *data,
+				      unsigned int len, unsigned int hdr_off)
+{
+	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+	unsigned int padding = 0;
+	struct sk_buff *skb;
+
+	if (len > hdr_off)
+		padding = (_rtl_rx_get_padding((void *)(data + hdr_off),
+					       len - hdr_off) - hdr_off) & 3;
+
+	skb = dev_alloc_skb(len + __RADIO_TAP_SIZE_RSV + padding);
+	if (!skb)
+		return NULL;
+
+	_rtl_install_trx_info(rtlusb, skb, rtlusb->in_ep);
+	skb_reserve(skb, padding + __RADIO_TAP_SIZE_RSV);
+	memcpy(skb_put(skb, len), data, len);
+	return skb;
+}
+EXPORT_SYMBOL(rtl_usb_rx_copy_frame);
+
 static void _rtl_rx_completed(struct urb *_urb)
 {
 	struct rtl_usb *rtlusb = (struct rtl_usb *)_urb->context;
@@ -640,8 +1015,15 @@ static void _rtl_rx_completed(struct urb *_urb)
 			goto resubmit;
 		}
 
+		/* an aggregate is copied again frame by frame when it is
+		 * split, each frame aligned for its own header
+		 */
 		hdr = (void *)(_urb->transfer_buffer + RTL_RX_DESC_SIZE);
-		padding = _rtl_rx_get_padding(hdr, size - RTL_RX_DESC_SIZE);
+		if (rtlusb->usb_rx_segregate_hdl)
+			padding = 0;
+		else
+			padding = _rtl_rx_get_padding(hdr,
+						      size - RTL_RX_DESC_SIZE);
 
 		skb = dev_alloc_skb(size + __RADIO_TAP_SIZE_RSV + padding);
 		if (!skb) {
@@ -686,8 +1068,8 @@ resubmit:
 	return;
 
 free:
-	/* On some architectures, usb_free_coherent must not be called from
-	 * hardirq context. Queue urb to cleanup list.
+	/* Park the urb with its buffer until the next rtl_usb_start(), they
+	 * are freed at disconnect.
 	 */
 	usb_anchor_urb(_urb, &rtlusb->rx_cleanup_urbs);
 }
@@ -698,7 +1080,6 @@ static void _rtl_usb_cleanup_rx(struct ieee80211_hw *hw)
 {
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
-	struct urb *urb;
 
 	usb_kill_anchored_urbs(&rtlusb->rx_submitted);
 
@@ -709,49 +1090,35 @@ static void _rtl_usb_cleanup_rx(struct ieee80211_hw *hw)
 	destroy_workqueue(rtlpriv->works.rtl_wq);
 
 	skb_queue_purge(&rtlusb->rx_queue);
-
-	while ((urb = usb_get_from_anchor(&rtlusb->rx_cleanup_urbs))) {
-		usb_free_coherent(urb->dev, urb->transfer_buffer_length,
-				urb->transfer_buffer, urb->transfer_dma);
-		usb_free_urb(urb);
-	}
 }
 
 static int _rtl_usb_receive(struct ieee80211_hw *hw)
 {
 	struct urb *urb;
-	int err;
-	int i;
+	int err = 0;
 	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
 
 	WARN_ON(0 == rtlusb->rx_urb_num);
 	/* 1600 == 1514 + max WLAN header + rtk info */
 	WARN_ON(rtlusb->rx_max_size < 1600);
 
-	for (i = 0; i < rtlusb->rx_urb_num; i++) {
-		err = -ENOMEM;
-		urb = usb_alloc_urb(0, GFP_KERNEL);
-		if (!urb)
-			goto err_out;
-
-		err = _rtl_prep_rx_urb(hw, rtlusb, urb, GFP_KERNEL);
-		if (err < 0) {
-			pr_err("Failed to prep_rx_urb!!\n");
-			usb_free_urb(urb);
-			goto err_out;
-		}
-
+	/* the URBs and buffers come from _rtl_usb_init_pools() */
+	while ((urb = usb_get_from_anchor(&rtlusb->rx_cleanup_urbs))) {
 		usb_anchor_urb(urb, &rtlusb->rx_submitted);
 		err = usb_submit_urb(urb, GFP_KERNEL);
-		if (err)
+		if (err) {
+			usb_unanchor_urb(urb);
+			usb_anchor_urb(urb, &rtlusb->rx_cleanup_urbs);
+			usb_free_urb(urb);
 			goto err_out;
+		}
 		usb_free_urb(urb);
 	}
 	return 0;
 
 err_out:
+	/* killed URBs go back to rx_cleanup_urbs */
 	usb_kill_anchored_urbs(&rtlusb->rx_submitted);
-	_rtl_usb_cleanup_rx(hw);
 	return err;
 }
 
@@ -761,8 +1128,17 @@ static int rtl_usb_start(struct ieee80211_hw *hw)
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_hal *rtlhal = rtl_hal(rtl_priv(hw));
 	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+	u64 xfers, writes;
 
+	xfers = rtlusb->io_ctrl_writes + rtlusb->io_ctrl_reads;
+	writes = rtlusb->io_reg_writes;
 	err = rtlpriv->cfg->ops->hw_init(hw);
+	rtlusb->io_init_xfers = rtlusb->io_ctrl_writes +
+				rtlusb->io_ctrl_reads - xfers;
+	rtlusb->io_init_reg_writes = rtlusb->io_reg_writes - writes;
+	RT_TRACE(rtlpriv, COMP_INIT, DBG_DMESG,
+		 "hw_init: %llu register writes in %llu control transfers\n",
+		 rtlusb->io_init_reg_writes, rtlusb->io_init_xfers);
 	if (!err) {
 		rtl_init_rx_config(hw);
 
@@ -783,28 +1159,48 @@ static int rtl_usb_start(struct ieee80211_hw *hw)
  */
 
 /*=======================  tx =========================================*/
-static void rtl_usb_cleanup(struct ieee80211_hw *hw)
+/* hands the frames still waiting on the endpoints back to mac80211 */
+static void _rtl_usb_tx_purge(struct ieee80211_hw *hw)
 {
-	u32 i;
-	struct sk_buff *_skb;
 	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
 	struct ieee80211_tx_info *txinfo;
+	struct sk_buff_head *queue;
+	struct sk_buff *_skb;
+	unsigned long flags;
+	u32 i;
 
-	/* clean up rx stuff. */
-	_rtl_usb_cleanup_rx(hw);
-
-	/* clean up tx stuff */
 	for (i = 0; i < RTL_USB_MAX_EP_NUM; i++) {
-		while ((_skb = skb_dequeue(&rtlusb->tx_skb_queue[i]))) {
+		queue = &rtlusb->tx_skb_queue[i];
+		spin_lock_irqsave(&queue->lock, flags);
+		while ((_skb = __skb_dequeue(queue))) {
 			rtlusb->usb_tx_cleanup(hw, _skb);
+			skb_pull(_skb, RTL_TX_HEADER_SIZE);
+			/* never sent, report it as not acked */
 			txinfo = IEEE80211_SKB_CB(_skb);
 			ieee80211_tx_info_clear_status(txinfo);
-			txinfo->flags |= IEEE80211_TX_STAT_ACK;
 			ieee80211_tx_status_irqsafe(hw, _skb);
 		}
-		usb_kill_anchored_urbs(&rtlusb->tx_pending[i]);
+		rtlusb->tx_agg_bytes[i] = 0;
+		spin_unlock_irqrestore(&queue->lock, flags);
 	}
+}
+
+static void rtl_usb_cleanup(struct ieee80211_hw *hw)
+{
+	u32 i;
+	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+
+	/* clean up rx stuff. */
+	_rtl_usb_cleanup_rx(hw);
+
+	/* clean up tx stuff */
+	hrtimer_cancel(&rtlusb->tx_agg_timer);
+	tasklet_kill(&rtlusb->tx_agg_tasklet);
+	_rtl_usb_tx_purge(hw);
+	for (i = 0; i < RTL_USB_MAX_EP_NUM; i++)
+		usb_kill_anchored_urbs(&rtlusb->tx_pending[i]);
 	usb_kill_anchored_urbs(&rtlusb->tx_submitted);
+	usb_kill_anchored_urbs(&rtlusb->ctrl_submitted);
 }
 
 /**
@@ -815,6 +1211,7 @@ static void rtl_usb_cleanup(struct ieee80211_hw *hw)
 static void rtl_usb_deinit(struct ieee80211_hw *hw)
 {
 	rtl_usb_cleanup(hw);
+	_rtl_usb_deinit_pools(hw);
 }
 
 static void rtl_usb_stop(struct ieee80211_hw *hw)
@@ -822,15 +1219,17 @@ static void rtl_usb_stop(struct ieee80211_hw *hw)
 	struct rtl_priv *rtlpriv = rtl_priv(hw);
 	struct rtl_hal *rtlhal = rtl_hal(rtl_priv(hw));
 	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
-	struct urb *urb;
 
 	/* should after adapter start and interrupt enable. */
 	set_hal_stop(rtlhal);
 	cancel_work_sync(&rtlpriv->works.fill_h2c_cmd);
 	/* Enable software */
 	SET_USB_STOP(rtlusb);
+	hrtimer_cancel(&rtlusb->tx_agg_timer);
+	tasklet_kill(&rtlusb->tx_agg_tasklet);
+	_rtl_usb_tx_purge(hw);
 
-	/* free pre-allocated URBs from rtl_usb_start() */
+	/* the bulk-IN URBs are kept for the next rtl_usb_start() */
 	usb_kill_anchored_urbs(&rtlusb->rx_submitted);
 
 	tasklet_kill(&rtlusb->rx_work_tasklet);
@@ -840,31 +1239,73 @@ static void rtl_usb_stop(struct ieee80211_hw *hw)
 
 	skb_queue_purge(&rtlusb->rx_queue);
 
-	while ((urb = usb_get_from_anchor(&rtlusb->rx_cleanup_urbs))) {
-		usb_free_coherent(urb->dev, urb->transfer_buffer_length,
-				urb->transfer_buffer, urb->transfer_dma);
-		usb_free_urb(urb);
+	rtlpriv->cfg->ops->hw_disable(hw);
+}
+
+/* Stops the mac80211 AC queues while the URB pool is empty or their
+ * endpoint has reached its in-flight limit, and wakes them once neither
+ * holds. Called after either condition changed; the lock keeps the last
+ * caller's view, which is the current one.
+ */
+static void _rtl_usb_tx_flow_update(struct ieee80211_hw *hw)
+{
+	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+	unsigned long flags;
+	bool stop;
+	u32 ep_num;
+	int q;
+
+	spin_lock_irqsave(&rtlusb->tx_flow_lock, flags);
+	for (q = RTL_TXQ_BK; q <= RTL_TXQ_VO; q++) {
+		ep_num = rtlusb->ep_map.ep_mapping[q];
+		stop = READ_ONCE(rtlusb->tx_urb_pool.stopped) ||
+		       test_bit(ep_num, &rtlusb->tx_ep_stopped);
+		if (stop == test_bit(q, &rtlusb->tx_queues_stopped))
+			continue;
+
+		if (stop) {
+			__set_bit(q, &rtlusb->tx_queues_stopped);
+			ieee80211_stop_queue(hw, q);
+		} else {
+			__clear_bit(q, &rtlusb->tx_queues_stopped);
+			ieee80211_wake_queue(hw, q);
+		}
 	}
+	spin_unlock_irqrestore(&rtlusb->tx_flow_lock, flags);
+}
 
-	rtlpriv->cfg->ops->hw_disable(hw);
+static bool _rtl_usb_tx_ep_full(struct rtl_usb *rtlusb, u32 ep_num)
+{
+	return atomic_read(&rtlusb->tx_inflight[ep_num]) >=
+	       RTL_USB_MAX_TX_URBS_NUM ||
+	       atomic_read(&rtlusb->tx_inflight_bytes[ep_num]) >=
+	       RTL_USB_MAX_TX_BYTES;
 }
 
 static void _rtl_submit_tx_urb(struct ieee80211_hw *hw, struct urb *_urb)
 {
 	int err;
 	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+	u32 ep_num = usb_pipeendpoint(_urb->pipe);
+
+	atomic_inc(&rtlusb->tx_inflight[ep_num]);
+	atomic_add(_urb->transfer_buffer_length,
+		   &rtlusb->tx_inflight_bytes[ep_num]);
+	if (_rtl_usb_tx_ep_full(rtlusb, ep_num) &&
+	    !test_and_set_bit(ep_num, &rtlusb->tx_ep_stopped)) {
+		rtlusb->tx_ep_stops[ep_num]++;
+		_rtl_usb_tx_flow_update(hw);
+	}
 
 	usb_anchor_urb(_urb, &rtlusb->tx_submitted);
 	err = usb_submit_urb(_urb, GFP_ATOMIC);
 	if (err < 0) {
-		struct sk_buff *skb;
-
 		pr_err("Failed to submit urb\n");
 		usb_unanchor_urb(_urb);
-		skb = (struct sk_buff *)_urb->context;
-		kfree_skb(skb);
+		/* complete it as failed so its frames are released */
+		_urb->status = err;
+		_urb->complete(_urb);
 	}
-	usb_free_urb(_urb);
 }
 
 static int _usb_tx_post(struct ieee80211_hw *hw, struct urb *urb,
@@ -876,53 +1317,282 @@ static int _usb_tx_post(struct ieee80211_hw *hw, struct urb *urb,
 	rtlusb->usb_tx_post_hdl(hw, urb, skb);
 	skb_pull(skb, RTL_TX_HEADER_SIZE);
 	txinfo = IEEE80211_SKB_CB(skb);
-	ieee80211_tx_info_clear_status(txinfo);
-	txinfo->flags |= IEEE80211_TX_STAT_ACK;
 
 	if (urb->status) {
 		pr_err("Urb has error status 0x%X\n", urb->status);
+		/* never reached the air */
+		ieee80211_tx_info_clear_status(txinfo);
 		goto out;
 	}
+	/* the status comes with the firmware TX report */
+	if (rtl_tx_report_hold(hw, skb))
+		return 0;
+
+	ieee80211_tx_info_clear_status(txinfo);
+	txinfo->flags |= IEEE80211_TX_STAT_ACK;
 	/*  TODO:	statistics */
 out:
 	ieee80211_tx_status_irqsafe(hw, skb);
 	return urb->status;
 }
 
+/* A bulk-OUT transfer finished and its URB is back in the pool. The
+ * endpoint's queues are woken once it is down to half its in-flight
+ * limit. Frames that queued up behind it, to be aggregated or for want of
+ * a URB, are sent from the aggregation tasklet, not from here: a failed
+ * submit completes its URB right away, with the queue lock held, and
+ * completions may run in hard interrupt context.
+ */
+static void _rtl_usb_tx_done(struct ieee80211_hw *hw, u32 ep_num, u32 len)
+{
+	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+
+	atomic_dec(&rtlusb->tx_inflight[ep_num]);
+	atomic_sub(len, &rtlusb->tx_inflight_bytes[ep_num]);
+	if (test_bit(ep_num, &rtlusb->tx_ep_stopped) &&
+	    atomic_read(&rtlusb->tx_inflight[ep_num]) <=
+	    RTL_USB_MAX_TX_URBS_NUM / 2 &&
+	    atomic_read(&rtlusb->tx_inflight_bytes[ep_num]) <=
+	    RTL_USB_MAX_TX_BYTES / 2 &&
+	    test_and_clear_bit(ep_num, &rtlusb->tx_ep_stopped))
+		_rtl_usb_tx_flow_update(hw);
+
+	if (!skb_queue_empty(&rtlusb->tx_skb_queue[ep_num]))
+		tasklet_schedule(&rtlusb->tx_agg_tasklet);
+}
+
 static void _rtl_tx_complete(struct urb *urb)
 {
 	struct sk_buff *skb = (struct sk_buff *)urb->context;
 	struct ieee80211_tx_info *info = IEEE80211_SKB_CB(skb);
 	struct rtl_usb *rtlusb = (struct rtl_usb *)info->rate_driver_data[0];
 	struct ieee80211_hw *hw = usb_get_intfdata(rtlusb->intf);
-	int err;
+	u32 ep_num = usb_pipeendpoint(urb->pipe);
+	u32 len = urb->transfer_buffer_length;
 
+	/* errors are ignored, other urbs keep being issued */
 	if (unlikely(IS_USB_STOP(rtlusb)))
+		ieee80211_free_txskb(hw, skb);
+	else
+		_usb_tx_post(hw, urb, skb);
+	_rtl_usb_urb_pool_put(&rtlusb->tx_urb_pool, urb);
+	_rtl_usb_tx_done(hw, ep_num, len);
+}
+
+static void _rtl_tx_agg_complete(struct urb *urb)
+{
+	struct sk_buff *agg = (struct sk_buff *)urb->context;
+	struct rtl_usb_tx_agg_cb *cb = (struct rtl_usb_tx_agg_cb *)agg->cb;
+	struct ieee80211_hw *hw = cb->hw;
+	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+	struct sk_buff *skb, *next;
+	u32 ep_num = cb->ep_num;
+	u32 len = urb->transfer_buffer_length;
+
+	for (skb = cb->frames; skb; skb = next) {
+		next = skb->next;
+		skb->next = NULL;
+		if (unlikely(IS_USB_STOP(rtlusb)))
+			ieee80211_free_txskb(hw, skb);
+		else
+			_usb_tx_post(hw, urb, skb);
+	}
+	_rtl_usb_tx_agg_buf_put(rtlusb, ep_num, agg);
+	_rtl_usb_urb_pool_put(&rtlusb->tx_urb_pool, urb);
+	_rtl_usb_tx_done(hw, ep_num, len);
+}
+
+static void _rtl_usb_tx_single(struct ieee80211_hw *hw, struct urb *_urb,
+			       struct sk_buff *skb, u32 ep_num)
+{
+	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+
+	_rtl_install_trx_info(rtlusb, skb, ep_num);
+	usb_fill_bulk_urb(_urb, rtlusb->udev, usb_sndbulkpipe(rtlusb->udev,
+			  ep_num), skb->data, skb->len, _rtl_tx_complete, skb);
+	_urb->transfer_flags = URB_ZERO_PACKET;
+	_rtl_submit_tx_urb(hw, _urb);
+}
+
+/* only frames of the four AC queues are aggregated */
+static bool _rtl_usb_tx_can_agg(struct rtl_usb *rtlusb, struct sk_buff *skb)
+{
+	struct ieee80211_hdr *hdr =
+		(struct ieee80211_hdr *)(skb->data + RTL_TX_HEADER_SIZE);
+
+	return rtlusb->usb_mq_to_hwq(hdr->frame_control,
+				     skb_get_queue_mapping(skb)) <= RTL_TXQ_VO;
+}
+
+/* Copies up to tx_agg_num frames from the head of the endpoint queue into
+ * one bulk-OUT transfer, each frame with its own TX descriptor and
+ * starting on an RTL_USB_TX_AGG_ALIGN boundary. Nothing is sent while the
+ * URB pool is empty. Called with the queue lock held.
+ */
+static void _rtl_usb_tx_agg_send(struct ieee80211_hw *hw, u32 ep_num)
+{
+	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+	struct sk_buff_head *queue = &rtlusb->tx_skb_queue[ep_num];
+	struct rtl_usb_tx_agg_cb *cb;
+	struct sk_buff *agg, *skb, **tail;
+	struct urb *_urb;
+	u32 len = 0, pad;
+	u8 agg_num = 0;
+	int i;
+
+	/* the queues are stopped, _rtl_usb_tx_done() carries on */
+	if (_rtl_usb_tx_ep_full(rtlusb, ep_num))
 		return;
-	err = _usb_tx_post(hw, urb, skb);
-	if (err) {
-		/* Ignore error and keep issuiing other urbs */
+	_urb = _rtl_usb_urb_pool_get(&rtlusb->tx_urb_pool);
+	if (!_urb)
+		return;
+
+	skb_queue_walk(queue, skb) {
+		if (agg_num == rtlusb->tx_agg_num ||
+		    (agg_num &&
+		     (ALIGN(len, RTL_USB_TX_AGG_ALIGN) + skb->len >
+		      rtlusb->tx_agg_size ||
+		      !_rtl_usb_tx_can_agg(rtlusb, skb))))
+			break;
+		len = ALIGN(len, RTL_USB_TX_AGG_ALIGN) + skb->len;
+		agg_num++;
+		if (rtlusb->tx_agg_num > 1 && !_rtl_usb_tx_can_agg(rtlusb, skb))
+			break;
+	}
+
+	rtlusb->tx_agg_hist[ep_num][agg_num]++;
+
+	if (agg_num == 1) {
+		skb = __skb_dequeue(queue);
+		rtlusb->tx_agg_bytes[ep_num] -= skb->len;
+		_rtl_usb_tx_single(hw, _urb, skb, ep_num);
+		return;
+	}
+
+	agg = _rtl_usb_tx_agg_buf_get(rtlusb, ep_num);
+	if (!agg) {
+		/* all are in flight, the next completion carries on */
+		_rtl_usb_urb_pool_put(&rtlusb->tx_urb_pool, _urb);
 		return;
 	}
+
+	BUILD_BUG_ON(sizeof(struct rtl_usb_tx_agg_cb) > sizeof(agg->cb));
+	cb = (struct rtl_usb_tx_agg_cb *)agg->cb;
+	cb->hw = hw;
+	cb->ep_num = ep_num;
+	cb->frames = NULL;
+	tail = &cb->frames;
+
+	for (i = 0; i < agg_num; i++) {
+		skb = __skb_dequeue(queue);
+		rtlusb->tx_agg_bytes[ep_num] -= skb->len;
+
+		pad = ALIGN(agg->len, RTL_USB_TX_AGG_ALIGN) - agg->len;
+		if (pad)
+			memset(skb_put(agg, pad), 0, pad);
+		skb_copy_from_linear_data(skb, skb_put(agg, skb->len),
+					  skb->len);
+
+		_rtl_install_trx_info(rtlusb, skb, ep_num);
+		*tail = skb;
+		tail = &skb->next;
+	}
+	*tail = NULL;
+
+	rtlusb->usb_tx_aggregate_hdl(hw, agg, agg_num);
+
+	usb_fill_bulk_urb(_urb, rtlusb->udev,
+			  usb_sndbulkpipe(rtlusb->udev, ep_num),
+			  agg->data, agg->len, _rtl_tx_agg_complete, agg);
+	_urb->transfer_flags = URB_ZERO_PACKET;
+	_rtl_submit_tx_urb(hw, _urb);
 }
 
-static struct urb *_rtl_usb_tx_urb_setup(struct ieee80211_hw *hw,
-				struct sk_buff *skb, u32 ep_num)
+/* Sends everything queued on the endpoint. Called with the queue lock
+ * held.
+ */
+static void _rtl_usb_tx_agg_flush(struct ieee80211_hw *hw, u32 ep_num)
 {
 	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
-	struct urb *_urb;
+	struct sk_buff_head *queue = &rtlusb->tx_skb_queue[ep_num];
+	u32 qlen;
 
-	WARN_ON(NULL == skb);
-	_urb = usb_alloc_urb(0, GFP_ATOMIC);
-	if (!_urb) {
-		kfree_skb(skb);
-		return NULL;
+	while ((qlen = skb_queue_len(queue))) {
+		_rtl_usb_tx_agg_send(hw, ep_num);
+		/* out of URBs or memory */
+		if (skb_queue_len(queue) == qlen)
+			break;
 	}
+}
+
+static void _rtl_usb_tx_agg_work(unsigned long param)
+{
+	struct rtl_usb *rtlusb = (struct rtl_usb *)param;
+	struct ieee80211_hw *hw = usb_get_intfdata(rtlusb->intf);
+	struct sk_buff_head *queue;
+	unsigned long flags;
+	u32 i;
+
+	if (unlikely(IS_USB_STOP(rtlusb)))
+		return;
+
+	for (i = 0; i < RTL_USB_MAX_EP_NUM; i++) {
+		queue = &rtlusb->tx_skb_queue[i];
+		if (skb_queue_empty(queue))
+			continue;
+
+		spin_lock_irqsave(&queue->lock, flags);
+		_rtl_usb_tx_agg_flush(hw, i);
+		spin_unlock_irqrestore(&queue->lock, flags);
+	}
+}
+
+/* runs in hard interrupt context, the copying is left to the tasklet */
+static enum hrtimer_restart _rtl_usb_tx_agg_timer_callback(struct hrtimer *timer)
+{
+	struct rtl_usb *rtlusb = container_of(timer, struct rtl_usb,
+					      tx_agg_timer);
+
+	if (unlikely(IS_USB_STOP(rtlusb)))
+		return HRTIMER_NORESTART;
+
+	rtlusb->tx_agg_timeouts++;
+	tasklet_schedule(&rtlusb->tx_agg_tasklet);
+	return HRTIMER_NORESTART;
+}
+
+/* Data frames wait on their endpoint while a bulk-OUT is in flight there,
+ * until a full aggregate is queued or txagg_timeout expires. With the
+ * endpoint idle, or for frames that may not wait, they go out at once
+ * unless the URB pool is empty.
+ */
+static void _rtl_usb_tx_agg_queue(struct ieee80211_hw *hw,
+				  struct sk_buff *skb, u32 ep_num,
+				  bool can_wait)
+{
+	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
+	struct sk_buff_head *queue = &rtlusb->tx_skb_queue[ep_num];
+	unsigned long flags;
+	bool wait;
+
 	_rtl_install_trx_info(rtlusb, skb, ep_num);
-	usb_fill_bulk_urb(_urb, rtlusb->udev, usb_sndbulkpipe(rtlusb->udev,
-			  ep_num), skb->data, skb->len, _rtl_tx_complete, skb);
-	_urb->transfer_flags |= URB_ZERO_PACKET;
-	return _urb;
+
+	spin_lock_irqsave(&queue->lock, flags);
+	__skb_queue_tail(queue, skb);
+	rtlusb->tx_agg_bytes[ep_num] += skb->len;
+
+	wait = can_wait && atomic_read(&rtlusb->tx_inflight[ep_num]) &&
+	       skb_queue_len(queue) < rtlusb->tx_agg_num &&
+	       rtlusb->tx_agg_bytes[ep_num] < rtlusb->tx_agg_size;
+	if (!wait)
+		_rtl_usb_tx_agg_flush(hw, ep_num);
+	spin_unlock_irqrestore(&queue->lock, flags);
+
+	if (wait && !hrtimer_active(&rtlusb->tx_agg_timer))
+		hrtimer_start(&rtlusb->tx_agg_timer,
+			      ns_to_ktime((u64)rtl_usb_tx_agg_timeout *
+					  NSEC_PER_USEC),
+			      HRTIMER_MODE_REL);
 }
 
 static void _rtl_usb_transmit(struct ieee80211_hw *hw, struct sk_buff *skb,
@@ -930,24 +1600,20 @@ static void _rtl_usb_transmit(struct ieee80211_hw *hw, struct sk_buff *skb,
 {
 	struct rtl_usb *rtlusb = rtl_usbdev(rtl_usbpriv(hw));
 	u32 ep_num;
-	struct urb *_urb = NULL;
-	struct sk_buff *_skb = NULL;
 
-	WARN_ON(NULL == rtlusb->usb_tx_aggregate_hdl);
 	if (unlikely(IS_USB_STOP(rtlusb))) {
 		pr_err("USB device is stopping...\n");
 		kfree_skb(skb);
 		return;
 	}
 	ep_num = rtlusb->ep_map.ep_mapping[qnum];
-	_skb = skb;
-	_urb = _rtl_usb_tx_urb_setup(hw, _skb, ep_num);
-	if (unlikely(!_urb)) {
-		pr_err("Can't allocate urb. Drop skb!\n");
-		kfree_skb(skb);
-		return;
-	}
-	_rtl_submit_tx_urb(hw, _urb);
+
+	/* every frame passes the endpoint queue, which keeps the order of
+	 * frames sharing the endpoint and holds them while the URB pool is
+	 * empty; only the four AC queues wait for an aggregate
+	 */
+	_rtl_usb_tx_agg_queue(hw, skb, ep_num,
+			      rtlusb->tx_agg_num > 1 && qnum <= RTL_TXQ_VO);
 }
 
 static void _rtl_usb_tx_preprocess(struct ieee80211_hw *hw,
@@ -982,11 +1648,11 @@ static void _rtl_usb_tx_preprocess(struct ieee80211_hw *hw,
 
 	rtl_action_proc(hw, skb, true);
 	if (is_multicast_ether_addr(pda_addr))
-		rtlpriv->stats.txbytesmulticast += skb->len;
+		rtl_data_stats_add(rtlpriv, tx_bytes_multicast, skb->len);
 	else if (is_broadcast_ether_addr(pda_addr))
-		rtlpriv->stats.txbytesbroadcast += skb->len;
+		rtl_data_stats_add(rtlpriv, tx_bytes_broadcast, skb->len);
 	else
-		rtlpriv->stats.txbytesunicast += skb->len;
+		rtl_data_stats_add(rtlpriv, tx_bytes_unicast, skb->len);
 	if (ieee80211_is_data_qos(fc)) {
 		qc = ieee80211_get_qos_ctl(hdr);
 		tid = qc[0] & IEEE80211_QOS_CTL_TID_MASK;
@@ -997,6 +1663,7 @@ static void _rtl_usb_tx_preprocess(struct ieee80211_hw *hw,
 	}
 	rtlpriv->cfg->ops->fill_tx_desc(hw, hdr, (u8 *)pdesc, NULL, info, sta, skb,
 					hw_queue, &tcb_desc);
+	rtl_tx_report_prepare(hw, skb, &tcb_desc);
 	if (!ieee80211_has_morefrags(hdr->frame_control)) {
 		if (qc)
 			mac->tids[tid].seq_number = seq_number;
@@ -1117,11 +1784,11 @@ int rtl_usb_probe(struct usb_interface *intf,
 	err = rtl_init_core(hw);
 	if (err) {
 		pr_err("Can't allocate sw for mac80211\n");
-		goto error_out;
+		goto error_out_pools;
 	}
 	if (rtlpriv->cfg->ops->init_sw_vars(hw)) {
 		pr_err("Can't init_sw_vars\n");
-		goto error_out;
+		goto error_out_pools;
 	}
 	rtlpriv->cfg->ops->init_sw_leds(hw);
 
@@ -1129,13 +1796,17 @@ int rtl_usb_probe(struct usb_interface *intf,
 	if (err) {
 		pr_err("Can't register mac80211 hw.\n");
 		err = -ENODEV;
-		goto error_out;
+		goto error_out_pools;
 	}
 	rtlpriv->mac80211.mac80211_registered = 1;
 
 	set_bit(RTL_STATUS_INTERFACE_START, &rtlpriv->status);
 	return 0;
 
+error_out_pools:
+	/* async register writes may still use the control URBs */
+	usb_kill_anchored_urbs(&usb_priv->dev.ctrl_submitted);
+	_rtl_usb_deinit_pools(hw);
 error_out:
 	rtl_deinit_core(hw);
 	_rtl_usb_io_handler_release(hw);
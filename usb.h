@@ -29,6 +29,7 @@
 #define __RTL_USB_H__
 
 #include <linux/skbuff.h>
+#include <linux/hrtimer.h>
 
 #define RTL_RX_DESC_SIZE		24
 
@@ -44,7 +45,25 @@
 
 #define RTL_USB_MAX_TXQ_NUM		4		/* max tx queue */
 #define RTL_USB_MAX_EP_NUM		6		/* max ep number */
+/* bulk-OUT in flight per endpoint before its queues are stopped */
 #define RTL_USB_MAX_TX_URBS_NUM		8
+#define RTL_USB_MAX_TX_BYTES		(128 * 1024)
+
+/* upper limit for the txagg module parameter */
+#define RTL_USB_TX_AGG_MAX_NUM		15
+/* frames in a TX aggregate start on this boundary */
+#define RTL_USB_TX_AGG_ALIGN		8
+
+#define RTL_USB_RX_AGG_HIST_SIZE	16
+
+/* TX aggregate buffers preallocated per endpoint, one per bulk-OUT that
+ * may be in flight there
+ */
+#define RTL_USB_TX_AGG_BUFS		RTL_USB_MAX_TX_URBS_NUM
+
+/* URBs preallocated for bulk-OUT and for async register writes */
+#define RTL_USB_TX_URB_POOL_SIZE	64
+#define RTL_USB_CTRL_URB_POOL_SIZE	64
 
 enum rtl_txq {
 	/* These definitions shall be consistent with value
@@ -72,6 +91,38 @@ struct _trx_info {
 	u32 ep_num;
 };
 
+/* skb->cb of a TX aggregate, the frames it carries are chained
+ * through skb->next
+ */
+struct rtl_usb_tx_agg_cb {
+	struct ieee80211_hw *hw;
+	struct sk_buff *frames;
+	u32 ep_num;
+};
+
+/* Fixed set of URBs handed out from a stack. A pool with hw set stops
+ * the mac80211 queues when it runs dry and wakes them once a quarter of
+ * it is back.
+ */
+struct rtl_usb_urb_pool {
+	spinlock_t lock;
+	struct urb **urbs;
+	struct ieee80211_hw *hw;
+	u16 size;
+	u16 free;
+	u16 min_free;
+	bool stopped;
+	u64 gets;
+	u64 misses;
+	u64 stalls;
+};
+
+/* setup packet and data of a pooled control URB */
+struct rtl_usb_ctrl_buf {
+	struct usb_ctrlrequest dr;
+	u8 data[REALTEK_USB_VENQT_MAX_BUF_SIZE];
+};
+
 static inline void _rtl_install_trx_info(struct rtl_usb *rtlusb,
 					 struct sk_buff *skb,
 					 u32 ep_num)
@@ -129,24 +180,82 @@ struct rtl_usb {
 	struct usb_anchor tx_pending[RTL_USB_MAX_EP_NUM];
 	struct usb_anchor tx_submitted;
 
-	struct sk_buff *(*usb_tx_aggregate_hdl)(struct ieee80211_hw *,
-						struct sk_buff_head *);
+	void (*usb_tx_aggregate_hdl)(struct ieee80211_hw *,
+				     struct sk_buff *, u8);
 	int (*usb_tx_post_hdl)(struct ieee80211_hw *,
 			       struct urb *, struct sk_buff *);
 	void (*usb_tx_cleanup)(struct ieee80211_hw *, struct sk_buff *);
 
+	/* TX aggregation, tx_agg_num 1 sends one frame per bulk-OUT */
+	u8 tx_agg_num;
+	u32 tx_agg_size;
+	u32 tx_agg_bytes[RTL_USB_MAX_EP_NUM];
+	atomic_t tx_inflight[RTL_USB_MAX_EP_NUM];
+	atomic_t tx_inflight_bytes[RTL_USB_MAX_EP_NUM];
+	/* flow control: endpoints at their in-flight limit, and the
+	 * mac80211 queues stopped for them or for the URB pool
+	 */
+	spinlock_t tx_flow_lock;
+	unsigned long tx_ep_stopped;
+	unsigned long tx_queues_stopped;
+	u64 tx_ep_stops[RTL_USB_MAX_EP_NUM];
+	/* the timer only schedules the tasklet, aggregates are built in
+	 * softirq context
+	 */
+	struct hrtimer tx_agg_timer;
+	struct tasklet_struct tx_agg_tasklet;
+	u64 tx_agg_timeouts;
+	/* bulk-OUT transfers per number of frames carried */
+	u64 tx_agg_hist[RTL_USB_MAX_EP_NUM][RTL_USB_TX_AGG_MAX_NUM + 1];
+	struct rtl_usb_urb_pool tx_urb_pool;
+	/* aggregate buffers of the endpoints the AC queues map to */
+	spinlock_t tx_agg_buf_lock;
+	struct sk_buff *tx_agg_bufs[RTL_USB_MAX_EP_NUM][RTL_USB_TX_AGG_BUFS];
+	u8 tx_agg_buf_num[RTL_USB_MAX_EP_NUM];
+	u8 tx_agg_buf_free[RTL_USB_MAX_EP_NUM];
+	u64 tx_agg_buf_misses;
+
+	/* async register writes */
+	struct rtl_usb_urb_pool ctrl_urb_pool;
+	struct rtl_usb_ctrl_buf *ctrl_bufs;
+	struct usb_anchor ctrl_submitted;
+
+	/* register writes combined between rtl_io_batch_begin() and
+	 * rtl_io_batch_end(), only for the task that opened the batch
+	 */
+	struct task_struct *io_batch_owner;
+	int io_batch_depth;
+	u32 io_batch_addr;
+	u16 io_batch_len;
+	u8 io_batch_buf[REALTEK_USB_VENQT_MAX_BUF_SIZE];
+
+	/* control transfers, and register writes they carried */
+	u64 io_ctrl_writes;
+	u64 io_ctrl_reads;
+	u64 io_reg_writes;
+	/* control transfers of the last hw_init */
+	u64 io_init_xfers;
+	u64 io_init_reg_writes;
+
 	/* Rx */
 	u8 in_ep_nums;
 	u32 in_ep;		/* Bulk IN endpoint number */
 	u32 rx_max_size;	/* Bulk IN max buffer size */
 	u32 rx_urb_num;		/* How many Bulk INs are submitted to host. */
 	struct usb_anchor	rx_submitted;
+	/* idle bulk-IN URBs, allocated once at probe */
 	struct usb_anchor	rx_cleanup_urbs;
 	struct tasklet_struct   rx_work_tasklet;
 	struct sk_buff_head	rx_queue;
 	void (*usb_rx_segregate_hdl)(struct ieee80211_hw *, struct sk_buff *,
 				     struct sk_buff_head *);
 	void (*usb_rx_hdl)(struct ieee80211_hw *, struct sk_buff *);
+
+	/* bulk-IN transfers split by usb_rx_segregate_hdl */
+	u64 rx_agg_urbs;
+	u64 rx_agg_frames;
+	/* transfers per number of frames carried */
+	u64 rx_agg_hist[RTL_USB_RX_AGG_HIST_SIZE];
 };
 
 struct rtl_usb_priv {
@@ -163,6 +272,8 @@ int rtl_usb_probe(struct usb_interface *intf,
 		  const struct usb_device_id *id,
 		  struct rtl_hal_cfg *rtl92cu_hal_cfg);
 void rtl_usb_disconnect(struct usb_interface *intf);
+struct sk_buff *rtl_usb_rx_copy_frame(struct ieee80211_hw *hw, const u8 *data,
+				      unsigned int len, unsigned int hdr_off);
 int rtl_usb_suspend(struct usb_interface *pusb_intf, pm_message_t message);
 int rtl_usb_resume(struct usb_interface *pusb_intf);
 
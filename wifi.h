@@ -35,6 +35,9 @@
 #include <linux/usb.h>
 #include <net/mac80211.h>
 #include <linux/completion.h>
+#include <linux/hashtable.h>
+#include <linux/percpu.h>
+#include <linux/u64_stats_sync.h>
 #include <linux/version.h>
 #include "debug.h"
 
@@ -119,6 +122,8 @@
 #define ASPM_L1_LATENCY				7
 
 #define TOTAL_CAM_ENTRY				32
+#define CAM_CONTENT_COUNT			8
+#define RTL_CAM_HASH_BITS			4
 
 /*slot time for 11g. */
 #define RTL_SLOT_TIME_9				9
@@ -1050,11 +1055,16 @@ struct init_gain {
 };
 
 struct wireless_stats {
+	/* summed up from the per CPU counters by the watchdog */
 	unsigned long txbytesunicast;
-	unsigned long txbytesmulticast;
-	unsigned long txbytesbroadcast;
 	unsigned long rxbytesunicast;
 
+	/* beacons and probe responses through rtl_parse_rx_mgmt(), and the
+	 * time spent on them up to rtl_rx_mgmt_done()
+	 */
+	u64 rx_bcn_parsed;
+	u64 rx_bcn_ns;
+
 	long rx_snr_db[4];
 	/*Correct smoothed ss in Dbm, only used
 	   in driver to report real power now. */
@@ -1226,6 +1236,107 @@ enum hw_param_tab_index {
 	MAX_TAB
 };
 
+/* register tables resolved for this board, see rtl_phy_prog_load() */
+enum rtl_phy_prog_id {
+	RTL_PHY_PROG_MAC,
+	RTL_PHY_PROG_PHY_REG,
+	RTL_PHY_PROG_AGC_TAB,
+	RTL_PHY_PROG_RADIO_A,
+	RTL_PHY_PROG_RADIO_B,
+	RTL_PHY_PROG_MAX
+};
+
+enum rtl_phy_write {
+	RTL_PHY_WRITE_BYTE,
+	RTL_PHY_WRITE_BB,
+	RTL_PHY_WRITE_RF,
+};
+
+struct rtl_phy_op {
+	u32 addr;
+	u32 mask;
+	u32 data;
+	/* after the write */
+	u32 delay_us;
+};
+
+struct rtl_phy_prog {
+	u8 type;
+	u8 rfpath;
+	/* delay records before the first write */
+	u32 lead_delay_us;
+	/* (addr, data) pairs in the source table */
+	u32 entries;
+	u64 compile_ns;
+	u64 run_ns;
+	u32 runs;
+	u32 len;
+	struct rtl_phy_op ops[];
+};
+
+/* TXAGC registers of one path, 4 rates per dword, CCK to VHT 2SS MCS9 */
+#define RTL_TXAGC_NUM				12
+/* bit of rtl_txpwr_agc.set for the power training register */
+#define RTL_TXAGC_TRAINING			(RTL_TXAGC_NUM * 4)
+#define RTL_TXPWR_CACHE_BW			3
+#define RTL_TXPWR_CACHE_PATH			2
+#define RTL_TXPWR_CACHE_LEN	((CHANNEL_MAX_NUMBER_2G +		\
+				  CHANNEL_MAX_NUMBER_5G) *		\
+				 RTL_TXPWR_CACHE_BW * RTL_TXPWR_CACHE_PATH)
+
+/* final power indexes of one (channel, bandwidth, path) */
+struct rtl_txpwr_agc {
+	u32 gen;
+	/* thermal tracking offsets the indexes were computed with */
+	s8 remnant_ofdm;
+	s8 remnant_cck;
+	/* one bit per rate byte in agc[], plus RTL_TXAGC_TRAINING */
+	u64 set;
+	u32 agc[RTL_TXAGC_NUM];
+	u32 training;
+};
+
+struct rtl_txpwr_stats {
+	u32 hits;
+	u32 misses;
+	u64 hit_ns;
+	u64 miss_ns;
+	u32 writes;
+	u32 skips;
+	/* channel sets with txpwr_nocache */
+	u32 bypasses;
+	u64 bypass_ns;
+};
+
+/* IQK results, per channel group, bandwidth and thermal meter bucket */
+#define RTL_CAL_VAL_NUM				(9 + IQK_MATRIX_REG_NUM)
+#define RTL_CAL_CHNL_GROUPS			6
+#define RTL_CAL_BW				3
+#define RTL_CAL_THERMAL_SHIFT			3
+#define RTL_CAL_THERMAL_BUCKETS			(64 >> RTL_CAL_THERMAL_SHIFT)
+#define RTL_CAL_CACHE_LEN	(RTL_CAL_CHNL_GROUPS * RTL_CAL_BW *	\
+				 RTL_CAL_THERMAL_BUCKETS)
+
+struct rtl_cal_entry {
+	bool valid;
+	u8 thermal;
+	u8 num;
+	/* jiffies of the calibration */
+	unsigned long stamp;
+	u64 cal_ns;
+	u32 val[RTL_CAL_VAL_NUM];
+};
+
+struct rtl_cal_stats {
+	u32 hits;
+	u32 misses;
+	u32 expired;
+	u32 cals;
+	u64 cal_ns;
+	/* calibration time the hits did not spend */
+	u64 saved_ns;
+};
+
 struct rtl_phy {
 	struct bb_reg_def phyreg_def[4];	/*Radio A/B/C/D */
 	struct init_gain initgain_backup;
@@ -1320,6 +1431,19 @@ struct rtl_phy {
 
 	u8 hw_rof_enable; /*Enable GPIO[9] as WL RF HW PDn source*/
 	enum rt_polarity_ctl polarity_ctl;
+
+	struct rtl_phy_prog *prog[RTL_PHY_PROG_MAX];
+
+	/* TX power index cache, bump txpwr_cache_gen to drop all entries */
+	struct rtl_txpwr_agc *txpwr_cache;
+	u32 txpwr_cache_gen;
+	/* what the TXAGC registers hold, per byte valid in _mask */
+	u32 txagc_shadow[RTL_TXPWR_CACHE_PATH][RTL_TXAGC_NUM + 1];
+	u32 txagc_shadow_mask[RTL_TXPWR_CACHE_PATH][RTL_TXAGC_NUM + 1];
+	struct rtl_txpwr_stats txpwr_stats;
+
+	struct rtl_cal_entry *cal_cache;
+	struct rtl_cal_stats cal_stats;
 };
 
 #define MAX_TID_COUNT				9
@@ -1387,6 +1511,10 @@ struct rtl_io {
 	u16(*read16_sync) (struct rtl_priv *rtlpriv, u32 addr);
 	u32(*read32_sync) (struct rtl_priv *rtlpriv, u32 addr);
 
+	/* write combining, NULL where writes are cheap */
+	void (*batch_begin) (struct rtl_priv *rtlpriv);
+	void (*batch_flush) (struct rtl_priv *rtlpriv);
+	void (*batch_end) (struct rtl_priv *rtlpriv);
 };
 
 struct rtl_mac {
@@ -1652,6 +1780,20 @@ struct rtl_security {
 	/*Cam Entry Bitmap */
 	u32 hwsec_cam_bitmap;
 	u8 hwsec_cam_sta_addr[TOTAL_CAM_ENTRY][ETH_ALEN];
+	/* hwsec_cam_bitmap entries, hashed by hwsec_cam_sta_addr */
+	struct hlist_node cam_sta_node[TOTAL_CAM_ENTRY];
+	DECLARE_HASHTABLE(cam_sta_hash, RTL_CAM_HASH_BITS);
+
+	/* what was written to the CAM; for entries in cam_synced it is
+	 * the whole entry, see cam.c
+	 */
+	u32 cam_shadow[TOTAL_CAM_ENTRY][CAM_CONTENT_COUNT];
+	u32 cam_synced;
+	/* dwords not written yet, per entry, while a batch is open */
+	u8 cam_dirty[TOTAL_CAM_ENTRY];
+	u8 cam_batch;
+	u64 cam_writes;
+	u64 cam_skipped;
 	/*local Key buffer, indx 0 is for
 	   pairwise key 1-4 is for agoup key. */
 	u8 key_buf[KEY_BUF_SIZE][MAX_KEY_LEN];
@@ -1920,11 +2062,108 @@ struct rtl_efuse {
 	u8 channel_plan;
 };
 
+/* bucket 0 is < 1 ms, bucket n is [2^(n-1), 2^n) ms, the last is open */
+#define RTL_TX_REPORT_WAIT_HIST	10
+/* pending frames are looked up by the low bits of their sn */
+#define RTL_TX_REPORT_SLOTS	256
+
 struct rtl_tx_report {
 	atomic_t sn;
 	u16 last_sent_sn;
-	unsigned long last_sent_time;
 	u16 last_recv_sn;
+	/* the last EAPOL frame sent, key removal waits for its report */
+	u16 eapol_sn;
+	bool eapol_pending;
+	unsigned long eapol_time;
+	/* woken by the report of eapol_sn, see rtl_wait_tx_report_acked() */
+	wait_queue_head_t waitq;
+	u64 waits;
+	u64 wait_timeouts;
+	u32 wait_hist[RTL_TX_REPORT_WAIT_HIST];
+
+	/* sent frames waiting for their firmware TX report, oldest first */
+	struct sk_buff_head queue;
+	/* the frame of each sn slot, under queue.lock. A frame whose slot
+	 * is taken is only on the queue.
+	 */
+	struct sk_buff *slot[RTL_TX_REPORT_SLOTS];
+	u32 unslotted;
+	u64 acked;
+	u64 failed;
+	u64 retries;
+	/* reports that never came or matched no frame */
+	u64 timeout;
+	u64 unmatched;
+};
+
+/* the firmware rate adaptation reports per mac_id */
+#define RTL_RC_MACID_NUM	64
+
+struct rtl_rate_priv;
+
+struct rtl_rc {
+	spinlock_t lock;
+	struct rtl_rate_priv *sta[RTL_RC_MACID_NUM];
+
+	/* set through debugfs, DESC_RATE* or -1: a fixed rate for unicast
+	 * data, or the rate it starts at before hardware fallback
+	 */
+	int fixed_rate;
+	int max_rate;
+};
+
+/* LPS decisions from the traffic estimate, see rtl_ps_gov_update() */
+struct rtl_ps_gov {
+	/* the governor wants LPS */
+	bool lps;
+	/* traffic at which LPS delays frames beyond the latency target */
+	u32 leave_pps;
+	/* frames within one watchdog period that mean the same */
+	u32 wake_pkts;
+	/* data frames seen in LPS since the last watchdog period */
+	atomic_t pkts;
+	unsigned long since;
+	u64 enters;
+	u64 leaves;
+	/* leaves before the watchdog, on a burst */
+	u64 burst_leaves;
+};
+
+/* power sequence flows filtered for this chip, see
+ * rtl_hal_pwrseqcmdparsing()
+ */
+#define RTL_PWRSEQ_PROG_MAX			8
+
+struct rtl_pwrseq_op {
+	u16 offset;
+	u8 cmd;
+	/* bytes of the dword that one PWR_CMD_WRITE read-modify-writes */
+	u8 lanes;
+	u32 mask;
+	/* microseconds for PWR_CMD_DELAY */
+	u32 value;
+	/* first flow entry of the step */
+	u16 entry;
+	u32 runs;
+	u32 last_ns;
+	u32 max_ns;
+	u64 total_ns;
+};
+
+struct rtl_pwrseq_prog {
+	const struct wlan_pwr_cfg *flow;
+	u8 cut;
+	u8 fab;
+	u8 intf;
+	/* flow entries up to PWR_CMD_END */
+	u16 entries;
+	u16 len;
+	u64 compile_ns;
+	u64 run_ns;
+	u64 max_ns;
+	u32 runs;
+	u32 fails;
+	struct rtl_pwrseq_op ops[];
 };
 
 struct rtl_ps_ctl {
@@ -2000,6 +2239,12 @@ struct rtl_ps_ctl {
 	u32 wakeup_reason;
 	/* Record the last waking time for comparison with setting key. */
 	u64 last_wakeup_time;
+
+	struct rtl_ps_gov gov;
+
+	/* IPS runs hw_init under ips_lock, power sequences must not sleep */
+	bool pwrseq_atomic;
+	struct rtl_pwrseq_prog *pwrseq[RTL_PWRSEQ_PROG_MAX];
 };
 
 struct rtl_stats {
@@ -2074,14 +2319,65 @@ struct rtl_stats {
 };
 
 
+/* weight of a new watchdog sample in the traffic rates, 1/2^n */
+#define RTL_TRAFFIC_EWMA_SHIFT		2
+
+/* frames per second; a flag drops again below 3/4 of its threshold */
+#define RTL_TRAFFIC_BUSY_PPS		50
+#define RTL_TRAFFIC_HIGHER_PPS		2000
+#define RTL_TRAFFIC_HIGHER_RX_PPS	2500
+
+/* Data path counters. Every CPU has its own copy, which is only ever
+ * added to; the watchdog, debugfs and ethtool sum them up with
+ * rtl_data_stats_read(). u64 only, they are also walked as an array.
+ */
+struct rtl_data_stats {
+	u64 tx_bytes_unicast;
+	u64 tx_bytes_multicast;
+	u64 tx_bytes_broadcast;
+	u64 rx_bytes_unicast;
+	/* TX OK interrupts of the data queues */
+	u64 tx_data;
+	/* unicast data frames */
+	u64 rx_data;
+	u64 tidtx[MAX_TID_COUNT];
+	/* data frames by mac80211 AC */
+	u64 tx_pkts[IEEE80211_NUM_ACS];
+	u64 tx_bytes[IEEE80211_NUM_ACS];
+	u64 rx_pkts[IEEE80211_NUM_ACS];
+	u64 rx_bytes[IEEE80211_NUM_ACS];
+};
+
+#define RTL_DATA_STATS_LEN	(sizeof(struct rtl_data_stats) / sizeof(u64))
+
+struct rtl_pcpu_stats {
+	struct rtl_data_stats s;
+	struct u64_stats_sync syncp;
+};
+
+struct rtl_traffic_ac {
+	/* per second, averaged and scaled by 1 << RTL_TRAFFIC_EWMA_SHIFT */
+	u32 tx_pps;
+	u32 rx_pps;
+	u32 tx_byte_rate;
+	u32 rx_byte_rate;
+};
+
 struct rt_link_detect {
 	/* count for roaming */
 	u32 bcn_rx_inperiod;
 	u32 roam_times;
 
-	u32 num_tx_in4period[4];
-	u32 num_rx_in4period[4];
+	/* by mac80211 AC, see rtl_traffic_update() */
+	struct rtl_traffic_ac ac[IEEE80211_NUM_ACS];
+	unsigned long traffic_time;
+	/* sum of the averages of all ACs, unscaled */
+	u32 tx_pps;
+	u32 rx_pps;
 
+	/* deltas of the data path counters over the last watchdog period,
+	 * set by rtl_traffic_update()
+	 */
 	u32 num_tx_inperiod;
 	u32 num_rx_inperiod;
 
@@ -2116,6 +2412,8 @@ struct rtl_tcb_desc {
 	u8 disable_ratefallback:1;
 
 	u8 use_spe_rpt:1;
+	u8 tx_report_eapol:1;
+	u16 tx_report_sn;
 
 	u8 ratr_index;
 	u8 mac_id;
@@ -2306,6 +2604,16 @@ struct rtl_mod_params {
 
 	/* select antenna */
 	int ant_sel;
+
+	/* USB RX aggregation threshold in 128-byte pages, 0 = off
+	 * submodules should set their own default value
+	 */
+	int usb_rx_agg;
+
+	/* default 0: 1 means compute and write the TX power indexes on
+	 * every channel set, without the cache (8821ae)
+	 */
+	bool txpwr_nocache;
 };
 
 struct rtl_hal_usbint_cfg {
@@ -2323,8 +2631,12 @@ struct rtl_hal_usbint_cfg {
 	void (*usb_tx_cleanup)(struct ieee80211_hw *, struct sk_buff *);
 	int (*usb_tx_post_hdl)(struct ieee80211_hw *, struct urb *,
 			       struct sk_buff *);
-	struct sk_buff *(*usb_tx_aggregate_hdl)(struct ieee80211_hw *,
-						struct sk_buff_head *);
+	/* fixes up the first descriptor of a multi-frame bulk-OUT */
+	void (*usb_tx_aggregate_hdl)(struct ieee80211_hw *, struct sk_buff *,
+				     u8 agg_num);
+	/* max frames and bytes per bulk-OUT */
+	u8 tx_agg_num;
+	u32 tx_agg_size;
 
 	/* endpoint mapping */
 	int (*usb_endpoint_mapping)(struct ieee80211_hw *hw);
@@ -2339,6 +2651,10 @@ struct rtl_hal_cfg {
 	struct rtl_hal_ops *ops;
 	struct rtl_mod_params *mod_params;
 	struct rtl_hal_usbint_cfg *usb_interface_cfg;
+	/* firmware sends a C2H TX report for frames with SPE_RPT set */
+	bool tx_status_report;
+	/* set_hw_reg() handles HW_VAR_INT_MIGRATION */
+	bool hw_int_migration;
 
 	/*this map used for some registers or vars
 	   defined int HAL but used in MAIN */
@@ -2363,7 +2679,6 @@ struct rtl_locks {
 	spinlock_t waitq_lock;
 	spinlock_t entry_list_lock;
 	spinlock_t usb_lock;
-	spinlock_t c2hcmd_lock;
 	spinlock_t scan_list_lock;
 
 	/*FW clock change */
@@ -2629,22 +2944,76 @@ struct proxim {
 	u8  (*proxim_get_var)(struct ieee80211_hw *hw, u8 type);
 };
 
+#define RTL_C2HCMD_RING_SIZE	64
+#define RTL_C2HCMD_MAX_LEN	64
+
 struct rtl_c2hcmd {
-	struct list_head list;
 	u8 tag;
 	u8 len;
-	u8 *val;
+	u8 val[RTL_C2HCMD_MAX_LEN];
 };
 
+/* C2H events deferred to c2hcmd_wq. The RX path is the only producer and
+ * the work the only consumer, so head and tail need no lock: each side
+ * writes its own index and reads the other's with acquire semantics.
+ */
+struct rtl_c2hcmd_ring {
+	struct rtl_c2hcmd slot[RTL_C2HCMD_RING_SIZE];
+	u32 head;
+	u32 tail;
+
+	/* written by the producer */
+	u64 enqueued;
+	u64 overflows;
+	u64 oversized;
+	u32 max_depth;
+	/* written by the consumer */
+	u64 processed;
+	u32 max_batch;
+};
+
+#define RTL_SCAN_HASH_BITS	6
+/* beyond this the least recently seen BSSID is recycled */
+#define RTL_SCAN_LIST_MAX	512
+
 struct rtl_bssid_entry {
+	struct hlist_node hnode;
 	struct list_head list;
 	u8 bssid[ETH_ALEN];
-	u32 age;
+	unsigned long age;
+};
+
+#define RTL_RX_MGMT_MAX_VENDOR_IES	16
+
+/* What the RX management consumers need from a frame, found in one pass
+ * by rtl_parse_rx_mgmt(). The element pointers point at the element ID.
+ */
+struct rtl_rx_mgmt {
+	struct ieee80211_hdr *hdr;
+	/* without FCS */
+	unsigned int len;
+	u64 start;
+
+	/* beacon or probe response */
+	bool bcn;
+	/* addr3 is the associated BSSID */
+	bool from_bssid;
+	/* longer than a beacon without elements */
+	bool has_ies;
+
+	u8 *tim;
+	u8 *p2p;
+	u8 *vendor[RTL_RX_MGMT_MAX_VENDOR_IES];
+	u8 num_vendor;
+	/* more vendor elements follow vendor[], consumers scan for them */
+	bool vendor_overflow;
 };
 
 struct rtl_scan_list {
 	int num;
 	struct list_head list;	/* sort by age */
+	DECLARE_HASHTABLE(hash, RTL_SCAN_HASH_BITS);
+	u32 recycled;
 };
 
 struct rtl_priv {
@@ -2667,6 +3036,7 @@ struct rtl_priv {
 	struct rtl_security sec;
 	struct rtl_efuse efuse;
 	struct rtl_tx_report tx_report;
+	struct rtl_rc rc;
 	struct rtl_scan_list scan_list;
 
 	struct rtl_ps_ctl psc;
@@ -2681,8 +3051,12 @@ struct rtl_priv {
 	/* sta entry list for ap adhoc or mesh */
 	struct list_head entry_list;
 
-	/* c2hcmd list for kthread level access */
-	struct list_head c2hcmd_list;
+	/* c2hcmd ring for kthread level access */
+	struct rtl_c2hcmd_ring c2hcmd_ring;
+
+	/* data path counters, and their sums at the last watchdog */
+	struct rtl_pcpu_stats __percpu *pcpu_stats;
+	struct rtl_data_stats data_last;
 
 	struct rtl_debug dbg;
 	int max_fw_size;
@@ -3052,6 +3426,29 @@ static inline void rtl_write_dword(struct rtl_priv *rtlpriv,
 		rtlpriv->io.read32_sync(rtlpriv, addr);
 }
 
+/* Between rtl_io_batch_begin() and rtl_io_batch_end() the interface may
+ * hold back register writes of the calling task and send adjacent ones
+ * together. Reads by the same task see them, a delay has to be preceded by
+ * rtl_io_batch_flush(). Batches nest.
+ */
+static inline void rtl_io_batch_begin(struct rtl_priv *rtlpriv)
+{
+	if (rtlpriv->io.batch_begin)
+		rtlpriv->io.batch_begin(rtlpriv);
+}
+
+static inline void rtl_io_batch_flush(struct rtl_priv *rtlpriv)
+{
+	if (rtlpriv->io.batch_flush)
+		rtlpriv->io.batch_flush(rtlpriv);
+}
+
+static inline void rtl_io_batch_end(struct rtl_priv *rtlpriv)
+{
+	if (rtlpriv->io.batch_end)
+		rtlpriv->io.batch_end(rtlpriv);
+}
+
 static inline u32 rtl_get_bbreg(struct ieee80211_hw *hw,
 				u32 regaddr, u32 bitmask)
 {
@@ -3132,6 +3529,45 @@ static inline u16 rtl_get_tid(struct sk_buff *skb)
 	return rtl_get_tid_h(rtl_get_hdr(skb));
 }
 
+static inline struct rtl_pcpu_stats *
+rtl_data_stats_begin(struct rtl_priv *rtlpriv, unsigned long *flags)
+{
+	struct rtl_pcpu_stats *pcpu;
+
+#if BITS_PER_LONG == 32 && defined(CONFIG_SMP)
+	/* the TX OK interrupt must not nest inside an update of the
+	 * same seqcount from softirq
+	 */
+	local_irq_save(*flags);
+#else
+	*flags = 0;
+#endif
+	pcpu = get_cpu_ptr(rtlpriv->pcpu_stats);
+	u64_stats_update_begin(&pcpu->syncp);
+	return pcpu;
+}
+
+static inline void rtl_data_stats_end(struct rtl_priv *rtlpriv,
+				      struct rtl_pcpu_stats *pcpu,
+				      unsigned long flags)
+{
+	u64_stats_update_end(&pcpu->syncp);
+	put_cpu_ptr(rtlpriv->pcpu_stats);
+#if BITS_PER_LONG == 32 && defined(CONFIG_SMP)
+	local_irq_restore(flags);
+#endif
+}
+
+#define rtl_data_stats_add(rtlpriv, field, val)				\
+do {									\
+	unsigned long __flags;						\
+	struct rtl_pcpu_stats *__pcpu =					\
+		rtl_data_stats_begin(rtlpriv, &__flags);		\
+									\
+	__pcpu->s.field += (val);					\
+	rtl_data_stats_end(rtlpriv, __pcpu, __flags);			\
+} while (0)
+
 static inline struct ieee80211_sta *get_sta(struct ieee80211_hw *hw,
 					    struct ieee80211_vif *vif,
 					    const u8 *bssid)